@@ -0,0 +1,327 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "batch.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+#include "qrender.h"
+#include "threadpool.h"
+
+// Number of records that can be in flight for each worker thread. Bounds the
+// memory used by the reorder buffer while a slow record holds back the output.
+#define JOBS_PER_WORKER 16
+
+typedef struct BatchState BatchState;
+
+typedef struct {
+  BatchState *batch;
+  size_t recordIndex;
+  char *record;
+  size_t recordCapacity;
+  size_t recordLength;
+  // Rendered symbol. The buffer is kept and reused by the next records of
+  // the slot.
+  char *output;
+  size_t outputCapacity;
+  size_t outputLength;
+  bool encoded;
+  bool done;  // Guarded by BatchState.lock.
+} BatchJob;
+
+struct BatchState {
+  ErrorCorrectionLevel errorCorrectionLevel;
+  const RenderOptions *renderOptions;
+  QrCode *workerQrCodes;
+  // Reorder buffer: record i lives in jobs[i % numJobs] until it is written.
+  BatchJob *jobs;
+  size_t numJobs;
+  FILE *out;
+  int separator;
+  // The following are guarded by lock.
+  size_t numRead;
+  size_t numWritten;
+  bool endOfInput;
+  // Set by the writer if a record could not be encoded or written.
+  bool allEncoded;
+  bool writeFailed;
+  pthread_mutex_t lock;
+  // Signaled when a job is done, a record is read or the input ends.
+  pthread_cond_t jobDone;
+  // Signaled when a record is written and its slot can be reused.
+  pthread_cond_t slotFree;
+};
+
+// Removes the separator (and a carriage return before a newline) from the end
+// of a record returned by getdelim.
+static size_t trimRecord(const char *record, size_t recordLength,
+                         int separator) {
+  if (recordLength > 0 && record[recordLength - 1] == separator) {
+    recordLength--;
+  }
+  if (separator == '\n' && recordLength > 0 &&
+      record[recordLength - 1] == '\r') {
+    recordLength--;
+  }
+  return recordLength;
+}
+
+// Renders the symbol into *buffer, growing it if needed, and stores the number
+// of bytes written in *length. Returns false if the buffer could not be grown.
+static bool renderToBuffer(const QrCode *qrcode, const RenderOptions *options,
+                           char **buffer, size_t *capacity, size_t *length) {
+  size_t size = getRenderedSize(qrcode, options);
+  if (size > *capacity) {
+    char *grown = (char *)realloc(*buffer, size);
+    if (grown == NULL) {
+      return false;
+    }
+    *buffer = grown;
+    *capacity = size;
+  }
+  *length = renderInto(qrcode, options, *buffer);
+  return true;
+}
+
+// Writes a rendered symbol, empty if the record could not be encoded, and
+// the separator after it. Returns false if they could not be written.
+static bool writeRecord(FILE *out, const char *output, size_t outputLength,
+                        int separator) {
+  return fwrite(output, 1, outputLength, out) == outputLength &&
+         fputc(separator, out) != EOF;
+}
+
+static bool runSequentialBatch(FILE *in, FILE *out, int separator,
+                               ErrorCorrectionLevel errorCorrectionLevel,
+                               const RenderOptions *renderOptions) {
+  bool allEncoded = true;
+  char *record = NULL;
+  size_t recordCapacity = 0;
+  size_t recordIndex = 0;
+
+  // A single context and output buffer are reused for every record.
+  QrCode qrcode;
+  char *output = NULL;
+  size_t outputCapacity = 0;
+  size_t outputLength;
+
+  ssize_t recordLength;
+  while ((recordLength = getdelim(&record, &recordCapacity, separator, in)) !=
+         -1) {
+    recordLength = trimRecord(record, recordLength, separator);
+    if (!encodeQrCode(&qrcode, (const unsigned char *)record, recordLength,
+                      errorCorrectionLevel) ||
+        !renderToBuffer(&qrcode, renderOptions, &output, &outputCapacity,
+                        &outputLength)) {
+      fprintf(stderr, "Could not encode record %zu\n", recordIndex);
+      allEncoded = false;
+      outputLength = 0;
+    }
+    // Every symbol is flushed as soon as it is written, for readers waiting
+    // on the other end of a pipe.
+    if (!writeRecord(out, output, outputLength, separator) ||
+        fflush(out) != 0) {
+      fprintf(stderr, "Could not write record %zu\n", recordIndex);
+      allEncoded = false;
+      break;
+    }
+    recordIndex++;
+  }
+
+  free(output);
+  free(record);
+  return allEncoded;
+}
+
+static void encodeJob(void *arg, unsigned int workerIndex) {
+  BatchJob *job = (BatchJob *)arg;
+  BatchState *batch = job->batch;
+  QrCode *qrcode = &batch->workerQrCodes[workerIndex];
+
+  job->encoded = encodeQrCode(qrcode, (const unsigned char *)job->record,
+                              job->recordLength, batch->errorCorrectionLevel);
+  if (job->encoded) {
+    job->encoded =
+        renderToBuffer(qrcode, batch->renderOptions, &job->output,
+                       &job->outputCapacity, &job->outputLength);
+  }
+
+  pthread_mutex_lock(&batch->lock);
+  job->done = true;
+  pthread_cond_signal(&batch->jobDone);
+  pthread_mutex_unlock(&batch->lock);
+}
+
+// Writes the records in input order as soon as they are encoded, so that a
+// reader on the other end of a pipe gets every symbol without waiting for the
+// next records to be read. Output is flushed whenever the next record is not
+// ready yet.
+static void *runWriter(void *arg) {
+  BatchState *batch = (BatchState *)arg;
+  pthread_mutex_lock(&batch->lock);
+  for (;;) {
+    size_t index = batch->numWritten;
+    BatchJob *job = &batch->jobs[index % batch->numJobs];
+    if (index == batch->numRead || !job->done) {
+      pthread_mutex_unlock(&batch->lock);
+      bool flushed = fflush(batch->out) == 0;
+      pthread_mutex_lock(&batch->lock);
+      if (!flushed) {
+        fprintf(stderr, "Could not write the output\n");
+        batch->writeFailed = true;
+        break;
+      }
+      while (index == batch->numRead ? !batch->endOfInput : !job->done) {
+        pthread_cond_wait(&batch->jobDone, &batch->lock);
+      }
+      // Every record was read and written.
+      if (index == batch->numRead) {
+        break;
+      }
+    }
+    pthread_mutex_unlock(&batch->lock);
+
+    bool encoded = job->encoded;
+    if (!encoded) {
+      fprintf(stderr, "Could not encode record %zu\n", index);
+    }
+    bool written = writeRecord(batch->out, job->output,
+                               encoded ? job->outputLength : 0,
+                               batch->separator);
+    if (!written) {
+      fprintf(stderr, "Could not write record %zu\n", index);
+    }
+
+    pthread_mutex_lock(&batch->lock);
+    batch->allEncoded &= encoded;
+    job->done = false;
+    batch->numWritten++;
+    pthread_cond_signal(&batch->slotFree);
+    if (!written) {
+      batch->writeFailed = true;
+      break;
+    }
+  }
+  // The reader stops as soon as it sees the failure.
+  pthread_cond_signal(&batch->slotFree);
+  pthread_mutex_unlock(&batch->lock);
+  return NULL;
+}
+
+static bool runParallelBatch(FILE *in, FILE *out, int separator,
+                             ErrorCorrectionLevel errorCorrectionLevel,
+                             const RenderOptions *renderOptions,
+                             unsigned int numThreads) {
+  BatchState batch = {0};
+  batch.errorCorrectionLevel = errorCorrectionLevel;
+  batch.renderOptions = renderOptions;
+  batch.numJobs = (size_t)numThreads * JOBS_PER_WORKER;
+  batch.workerQrCodes = (QrCode *)malloc(numThreads * sizeof(QrCode));
+  batch.jobs = (BatchJob *)calloc(batch.numJobs, sizeof(BatchJob));
+  ThreadPool *pool = createThreadPool(numThreads);
+  if (batch.workerQrCodes == NULL || batch.jobs == NULL || pool == NULL) {
+    fprintf(stderr, "Could not start %u worker threads\n", numThreads);
+    free(batch.workerQrCodes);
+    free(batch.jobs);
+    if (pool != NULL) {
+      destroyThreadPool(pool);
+    }
+    return false;
+  }
+  batch.out = out;
+  batch.separator = separator;
+  batch.allEncoded = true;
+  pthread_mutex_init(&batch.lock, NULL);
+  pthread_cond_init(&batch.jobDone, NULL);
+  pthread_cond_init(&batch.slotFree, NULL);
+
+  pthread_t writer;
+  bool writerStarted = pthread_create(&writer, NULL, runWriter, &batch) == 0;
+  if (!writerStarted) {
+    fprintf(stderr, "Could not start the writer thread\n");
+  }
+  while (writerStarted) {
+    // Records are written strictly in input order: once the reorder buffer is
+    // full, wait for the oldest record to be written before reading a new one.
+    pthread_mutex_lock(&batch.lock);
+    while (batch.numRead - batch.numWritten == batch.numJobs &&
+           !batch.writeFailed) {
+      pthread_cond_wait(&batch.slotFree, &batch.lock);
+    }
+    bool writeFailed = batch.writeFailed;
+    pthread_mutex_unlock(&batch.lock);
+    if (writeFailed) {
+      break;
+    }
+
+    BatchJob *job = &batch.jobs[batch.numRead % batch.numJobs];
+    ssize_t recordLength =
+        getdelim(&job->record, &job->recordCapacity, separator, in);
+    if (recordLength == -1) {
+      break;
+    }
+    job->batch = &batch;
+    job->recordIndex = batch.numRead;
+    job->recordLength = trimRecord(job->record, recordLength, separator);
+    bool submitted = submitThreadPoolTask(pool, encodeJob, job);
+
+    pthread_mutex_lock(&batch.lock);
+    if (!submitted) {
+      job->encoded = false;
+      job->done = true;
+    }
+    batch.numRead++;
+    pthread_cond_signal(&batch.jobDone);
+    pthread_mutex_unlock(&batch.lock);
+  }
+
+  pthread_mutex_lock(&batch.lock);
+  batch.endOfInput = true;
+  pthread_cond_signal(&batch.jobDone);
+  pthread_mutex_unlock(&batch.lock);
+  if (writerStarted) {
+    pthread_join(writer, NULL);
+  }
+
+  destroyThreadPool(pool);
+  for (size_t i = 0; i < batch.numJobs; i++) {
+    free(batch.jobs[i].record);
+    free(batch.jobs[i].output);
+  }
+  pthread_cond_destroy(&batch.slotFree);
+  pthread_cond_destroy(&batch.jobDone);
+  pthread_mutex_destroy(&batch.lock);
+  free(batch.jobs);
+  free(batch.workerQrCodes);
+  return writerStarted && batch.allEncoded && !batch.writeFailed;
+}
+
+bool runBatch(FILE *in, FILE *out, int separator,
+              ErrorCorrectionLevel errorCorrectionLevel,
+              const RenderOptions *renderOptions, unsigned int numThreads) {
+  if (numThreads <= 1) {
+    return runSequentialBatch(in, out, separator, errorCorrectionLevel,
+                              renderOptions);
+  }
+  return runParallelBatch(in, out, separator, errorCorrectionLevel,
+                          renderOptions, numThreads);
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "qrender.h"
+
+/** Encodes one QR Code per record read from in and writes them to out.
+ *
+ * Every symbol uses the given error correction level and is rendered with
+ * the given options. Records are delimited by separator. Every rendered
+ * symbol is followed by the same separator, so the n-th output record always
+ * belongs to the n-th input record; records that cannot be encoded produce an
+ * empty output record.
+ * When the separator is a newline, a trailing carriage return is dropped from
+ * each record.
+ *
+ * With more than one thread, records are encoded concurrently by a pool of
+ * numThreads workers, each owning its own QrCode, and the output is reordered
+ * to match the input by a writer thread.
+ *
+ * Every symbol is flushed as soon as it and the ones before it are encoded,
+ * without waiting for more input, so that out can be read as a stream.
+ *
+ * Returns false if at least one record could not be encoded, or if the output
+ * could not be written, in which case the remaining records are not read.
+ */
+bool runBatch(FILE *in, FILE *out, int separator,
+              ErrorCorrectionLevel errorCorrectionLevel,
+              const RenderOptions *renderOptions, unsigned int numThreads);
+
+#endif  // BATCH_H_
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmark of the Reed-Solomon encoder, one run per GF(256)
+// multiplication backend.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "qrender.h"
+
+#define NUM_ITERATIONS 200000
+#define NUM_MESSAGES 64
+#define MAX_DATA_CODEWORDS 128
+#define MAX_EC_CODEWORDS 30
+
+typedef struct {
+  const char *name;
+  unsigned int numDataCodewords;
+  unsigned int numEcCodewords;
+} BlockShape;
+
+// The smallest and largest blocks of error correction level L.
+static const BlockShape blockShapes[] = {
+    {"1-L", 19, 7},
+    {"40-L", 118, 30},
+};
+
+static double nowInSeconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void benchmarkBackend(
+    const char *name, GfMulBackend backend, const BlockShape *shape,
+    unsigned char messages[][MAX_DATA_CODEWORDS + MAX_EC_CODEWORDS]) {
+  setGfMulBackend(backend);
+
+  unsigned int checksum = 0;
+  double start = nowInSeconds();
+  for (unsigned int i = 0; i < NUM_ITERATIONS; i++) {
+    unsigned char *codewords = messages[i % NUM_MESSAGES];
+    writeErrorCorrectionCodewords(codewords, shape->numDataCodewords,
+                                  shape->numEcCodewords);
+    checksum += codewords[shape->numDataCodewords];
+  }
+  double elapsed = nowInSeconds() - start;
+
+  printf("%-16s %8.1f ns/block %8.1f MB/s (checksum %u)\n", name,
+         elapsed * 1e9 / NUM_ITERATIONS,
+         NUM_ITERATIONS * (double)shape->numDataCodewords / elapsed / 1e6,
+         checksum);
+}
+
+int main(void) {
+  static unsigned char
+      messages[NUM_MESSAGES][MAX_DATA_CODEWORDS + MAX_EC_CODEWORDS];
+  for (size_t i = 0; i < sizeof(blockShapes) / sizeof(blockShapes[0]); i++) {
+    const BlockShape *shape = &blockShapes[i];
+    srand(42);
+    for (unsigned int j = 0; j < NUM_MESSAGES; j++) {
+      for (unsigned int k = 0; k < shape->numDataCodewords; k++) {
+        messages[j][k] = rand() & 0xff;
+      }
+    }
+
+    printf("Reed-Solomon %s, %u data + %u EC codewords, %d iterations\n",
+           shape->name, shape->numDataCodewords, shape->numEcCodewords,
+           NUM_ITERATIONS);
+    benchmarkBackend("log/exp", GF_MUL_LOG_EXP, shape, messages);
+    benchmarkBackend("product table", GF_MUL_PRODUCT_TABLE, shape, messages);
+    benchmarkBackend("generator rows", GF_MUL_GENERATOR_ROWS, shape,
+                     messages);
+    benchmarkBackend("split nibble", GF_MUL_SPLIT_NIBBLE, shape, messages);
+  }
+  return 0;
+}
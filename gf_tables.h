@@ -0,0 +1,1254 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Generated by tools/gen_gf_tables.py. Do not edit.
+
+#ifndef GF_TABLES_H_
+#define GF_TABLES_H_
+
+// gfExpLookupTable[i] = α^i, for 0 <= i < 512.
+static const unsigned char gfExpLookupTable[512] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8,
+    0xcd, 0x87, 0x13, 0x26, 0x4c, 0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9,
+    0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d, 0x27, 0x4e, 0x9c,
+    0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23,
+    0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2,
+    0xb9, 0x6f, 0xde, 0xa1, 0x5f, 0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc,
+    0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd, 0xe7, 0xd3, 0xbb,
+    0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2,
+    0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68,
+    0xd0, 0xbd, 0x67, 0xce, 0x81, 0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93,
+    0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85, 0x17, 0x2e, 0x5c,
+    0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54,
+    0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72,
+    0xe4, 0xd5, 0xb7, 0x73, 0xe6, 0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e,
+    0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3, 0xdb, 0xab, 0x4b,
+    0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0,
+    0xdd, 0xa7, 0x53, 0xa6, 0x51, 0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef,
+    0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12, 0x24, 0x48, 0x90,
+    0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16,
+    0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8,
+    0xad, 0x47, 0x8e, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d,
+    0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26, 0x4c, 0x98, 0x2d, 0x5a, 0xb4,
+    0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d,
+    0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee,
+    0xc1, 0x9f, 0x23, 0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d,
+    0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1, 0x5f, 0xbe, 0x61, 0xc2, 0x99,
+    0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd,
+    0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b,
+    0xb6, 0x71, 0xe2, 0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d,
+    0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce, 0x81, 0x1f, 0x3e, 0x7c, 0xf8,
+    0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85,
+    0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84,
+    0x15, 0x2a, 0x54, 0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49,
+    0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73, 0xe6, 0xd1, 0xbf, 0x63, 0xc6,
+    0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3,
+    0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5,
+    0x57, 0xae, 0x41, 0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c,
+    0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6, 0x51, 0xa2, 0x59, 0xb2, 0x79,
+    0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12,
+    0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb,
+    0x8b, 0x0b, 0x16, 0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b,
+    0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e, 0x01, 0x02,
+};
+
+// gfLogLookupTable[α^i] = i. The entry for 0 is unused.
+static const unsigned char gfLogLookupTable[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1a, 0xc6, 0x03, 0xdf, 0x33, 0xee,
+    0x1b, 0x68, 0xc7, 0x4b, 0x04, 0x64, 0xe0, 0x0e, 0x34, 0x8d, 0xef, 0x81,
+    0x1c, 0xc1, 0x69, 0xf8, 0xc8, 0x08, 0x4c, 0x71, 0x05, 0x8a, 0x65, 0x2f,
+    0xe1, 0x24, 0x0f, 0x21, 0x35, 0x93, 0x8e, 0xda, 0xf0, 0x12, 0x82, 0x45,
+    0x1d, 0xb5, 0xc2, 0x7d, 0x6a, 0x27, 0xf9, 0xb9, 0xc9, 0x9a, 0x09, 0x78,
+    0x4d, 0xe4, 0x72, 0xa6, 0x06, 0xbf, 0x8b, 0x62, 0x66, 0xdd, 0x30, 0xfd,
+    0xe2, 0x98, 0x25, 0xb3, 0x10, 0x91, 0x22, 0x88, 0x36, 0xd0, 0x94, 0xce,
+    0x8f, 0x96, 0xdb, 0xbd, 0xf1, 0xd2, 0x13, 0x5c, 0x83, 0x38, 0x46, 0x40,
+    0x1e, 0x42, 0xb6, 0xa3, 0xc3, 0x48, 0x7e, 0x6e, 0x6b, 0x3a, 0x28, 0x54,
+    0xfa, 0x85, 0xba, 0x3d, 0xca, 0x5e, 0x9b, 0x9f, 0x0a, 0x15, 0x79, 0x2b,
+    0x4e, 0xd4, 0xe5, 0xac, 0x73, 0xf3, 0xa7, 0x57, 0x07, 0x70, 0xc0, 0xf7,
+    0x8c, 0x80, 0x63, 0x0d, 0x67, 0x4a, 0xde, 0xed, 0x31, 0xc5, 0xfe, 0x18,
+    0xe3, 0xa5, 0x99, 0x77, 0x26, 0xb8, 0xb4, 0x7c, 0x11, 0x44, 0x92, 0xd9,
+    0x23, 0x20, 0x89, 0x2e, 0x37, 0x3f, 0xd1, 0x5b, 0x95, 0xbc, 0xcf, 0xcd,
+    0x90, 0x87, 0x97, 0xb2, 0xdc, 0xfc, 0xbe, 0x61, 0xf2, 0x56, 0xd3, 0xab,
+    0x14, 0x2a, 0x5d, 0x9e, 0x84, 0x3c, 0x39, 0x53, 0x47, 0x6d, 0x41, 0xa2,
+    0x1f, 0x2d, 0x43, 0xd8, 0xb7, 0x7b, 0xa4, 0x76, 0xc4, 0x17, 0x49, 0xec,
+    0x7f, 0x0c, 0x6f, 0xf6, 0x6c, 0xa1, 0x3b, 0x52, 0x29, 0x9d, 0x55, 0xaa,
+    0xfb, 0x60, 0x86, 0xb1, 0xbb, 0xcc, 0x3e, 0x5a, 0xcb, 0x59, 0x5f, 0xb0,
+    0x9c, 0xa9, 0xa0, 0x51, 0x0b, 0xf5, 0x16, 0xeb, 0x7a, 0x75, 0x2c, 0xd7,
+    0x4f, 0xae, 0xd5, 0xe9, 0xe6, 0xe7, 0xad, 0xe8, 0x74, 0xd6, 0xf4, 0xea,
+    0xa8, 0x50, 0x58, 0xaf,
+};
+
+// gfNibbleProductTable[f] = {f * n, f * (n << 4)} for 0 <= n < 16.
+static const unsigned char gfNibbleProductTable[256][32] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+     0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+     0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70,
+     0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0},
+    {0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e,
+     0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e,
+     0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0,
+     0x1d, 0x3d, 0x5d, 0x7d, 0x9d, 0xbd, 0xdd, 0xfd},
+    {0x00, 0x03, 0x06, 0x05, 0x0c, 0x0f, 0x0a, 0x09,
+     0x18, 0x1b, 0x1e, 0x1d, 0x14, 0x17, 0x12, 0x11,
+     0x00, 0x30, 0x60, 0x50, 0xc0, 0xf0, 0xa0, 0x90,
+     0x9d, 0xad, 0xfd, 0xcd, 0x5d, 0x6d, 0x3d, 0x0d},
+    {0x00, 0x04, 0x08, 0x0c, 0x10, 0x14, 0x18, 0x1c,
+     0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38, 0x3c,
+     0x00, 0x40, 0x80, 0xc0, 0x1d, 0x5d, 0x9d, 0xdd,
+     0x3a, 0x7a, 0xba, 0xfa, 0x27, 0x67, 0xa7, 0xe7},
+    {0x00, 0x05, 0x0a, 0x0f, 0x14, 0x11, 0x1e, 0x1b,
+     0x28, 0x2d, 0x22, 0x27, 0x3c, 0x39, 0x36, 0x33,
+     0x00, 0x50, 0xa0, 0xf0, 0x5d, 0x0d, 0xfd, 0xad,
+     0xba, 0xea, 0x1a, 0x4a, 0xe7, 0xb7, 0x47, 0x17},
+    {0x00, 0x06, 0x0c, 0x0a, 0x18, 0x1e, 0x14, 0x12,
+     0x30, 0x36, 0x3c, 0x3a, 0x28, 0x2e, 0x24, 0x22,
+     0x00, 0x60, 0xc0, 0xa0, 0x9d, 0xfd, 0x5d, 0x3d,
+     0x27, 0x47, 0xe7, 0x87, 0xba, 0xda, 0x7a, 0x1a},
+    {0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+     0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+     0x00, 0x70, 0xe0, 0x90, 0xdd, 0xad, 0x3d, 0x4d,
+     0xa7, 0xd7, 0x47, 0x37, 0x7a, 0x0a, 0x9a, 0xea},
+    {0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38,
+     0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78,
+     0x00, 0x80, 0x1d, 0x9d, 0x3a, 0xba, 0x27, 0xa7,
+     0x74, 0xf4, 0x69, 0xe9, 0x4e, 0xce, 0x53, 0xd3},
+    {0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f,
+     0x48, 0x41, 0x5a, 0x53, 0x6c, 0x65, 0x7e, 0x77,
+     0x00, 0x90, 0x3d, 0xad, 0x7a, 0xea, 0x47, 0xd7,
+     0xf4, 0x64, 0xc9, 0x59, 0x8e, 0x1e, 0xb3, 0x23},
+    {0x00, 0x0a, 0x14, 0x1e, 0x28, 0x22, 0x3c, 0x36,
+     0x50, 0x5a, 0x44, 0x4e, 0x78, 0x72, 0x6c, 0x66,
+     0x00, 0xa0, 0x5d, 0xfd, 0xba, 0x1a, 0xe7, 0x47,
+     0x69, 0xc9, 0x34, 0x94, 0xd3, 0x73, 0x8e, 0x2e},
+    {0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31,
+     0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69,
+     0x00, 0xb0, 0x7d, 0xcd, 0xfa, 0x4a, 0x87, 0x37,
+     0xe9, 0x59, 0x94, 0x24, 0x13, 0xa3, 0x6e, 0xde},
+    {0x00, 0x0c, 0x18, 0x14, 0x30, 0x3c, 0x28, 0x24,
+     0x60, 0x6c, 0x78, 0x74, 0x50, 0x5c, 0x48, 0x44,
+     0x00, 0xc0, 0x9d, 0x5d, 0x27, 0xe7, 0xba, 0x7a,
+     0x4e, 0x8e, 0xd3, 0x13, 0x69, 0xa9, 0xf4, 0x34},
+    {0x00, 0x0d, 0x1a, 0x17, 0x34, 0x39, 0x2e, 0x23,
+     0x68, 0x65, 0x72, 0x7f, 0x5c, 0x51, 0x46, 0x4b,
+     0x00, 0xd0, 0xbd, 0x6d, 0x67, 0xb7, 0xda, 0x0a,
+     0xce, 0x1e, 0x73, 0xa3, 0xa9, 0x79, 0x14, 0xc4},
+    {0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a,
+     0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a,
+     0x00, 0xe0, 0xdd, 0x3d, 0xa7, 0x47, 0x7a, 0x9a,
+     0x53, 0xb3, 0x8e, 0x6e, 0xf4, 0x14, 0x29, 0xc9},
+    {0x00, 0x0f, 0x1e, 0x11, 0x3c, 0x33, 0x22, 0x2d,
+     0x78, 0x77, 0x66, 0x69, 0x44, 0x4b, 0x5a, 0x55,
+     0x00, 0xf0, 0xfd, 0x0d, 0xe7, 0x17, 0x1a, 0xea,
+     0xd3, 0x23, 0x2e, 0xde, 0x34, 0xc4, 0xc9, 0x39},
+    {0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70,
+     0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0,
+     0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53,
+     0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb},
+    {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+     0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+     0x00, 0x0d, 0x1a, 0x17, 0x34, 0x39, 0x2e, 0x23,
+     0x68, 0x65, 0x72, 0x7f, 0x5c, 0x51, 0x46, 0x4b},
+    {0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e,
+     0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee,
+     0x00, 0x3d, 0x7a, 0x47, 0xf4, 0xc9, 0x8e, 0xb3,
+     0xf5, 0xc8, 0x8f, 0xb2, 0x01, 0x3c, 0x7b, 0x46},
+    {0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79,
+     0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1,
+     0x00, 0x2d, 0x5a, 0x77, 0xb4, 0x99, 0xee, 0xc3,
+     0x75, 0x58, 0x2f, 0x02, 0xc1, 0xec, 0x9b, 0xb6},
+    {0x00, 0x14, 0x28, 0x3c, 0x50, 0x44, 0x78, 0x6c,
+     0xa0, 0xb4, 0x88, 0x9c, 0xf0, 0xe4, 0xd8, 0xcc,
+     0x00, 0x5d, 0xba, 0xe7, 0x69, 0x34, 0xd3, 0x8e,
+     0xd2, 0x8f, 0x68, 0x35, 0xbb, 0xe6, 0x01, 0x5c},
+    {0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b,
+     0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3,
+     0x00, 0x4d, 0x9a, 0xd7, 0x29, 0x64, 0xb3, 0xfe,
+     0x52, 0x1f, 0xc8, 0x85, 0x7b, 0x36, 0xe1, 0xac},
+    {0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62,
+     0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2,
+     0x00, 0x7d, 0xfa, 0x87, 0xe9, 0x94, 0x13, 0x6e,
+     0xcf, 0xb2, 0x35, 0x48, 0x26, 0x5b, 0xdc, 0xa1},
+    {0x00, 0x17, 0x2e, 0x39, 0x5c, 0x4b, 0x72, 0x65,
+     0xb8, 0xaf, 0x96, 0x81, 0xe4, 0xf3, 0xca, 0xdd,
+     0x00, 0x6d, 0xda, 0xb7, 0xa9, 0xc4, 0x73, 0x1e,
+     0x4f, 0x22, 0x95, 0xf8, 0xe6, 0x8b, 0x3c, 0x51},
+    {0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48,
+     0xc0, 0xd8, 0xf0, 0xe8, 0xa0, 0xb8, 0x90, 0x88,
+     0x00, 0x9d, 0x27, 0xba, 0x4e, 0xd3, 0x69, 0xf4,
+     0x9c, 0x01, 0xbb, 0x26, 0xd2, 0x4f, 0xf5, 0x68},
+    {0x00, 0x19, 0x32, 0x2b, 0x64, 0x7d, 0x56, 0x4f,
+     0xc8, 0xd1, 0xfa, 0xe3, 0xac, 0xb5, 0x9e, 0x87,
+     0x00, 0x8d, 0x07, 0x8a, 0x0e, 0x83, 0x09, 0x84,
+     0x1c, 0x91, 0x1b, 0x96, 0x12, 0x9f, 0x15, 0x98},
+    {0x00, 0x1a, 0x34, 0x2e, 0x68, 0x72, 0x5c, 0x46,
+     0xd0, 0xca, 0xe4, 0xfe, 0xb8, 0xa2, 0x8c, 0x96,
+     0x00, 0xbd, 0x67, 0xda, 0xce, 0x73, 0xa9, 0x14,
+     0x81, 0x3c, 0xe6, 0x5b, 0x4f, 0xf2, 0x28, 0x95},
+    {0x00, 0x1b, 0x36, 0x2d, 0x6c, 0x77, 0x5a, 0x41,
+     0xd8, 0xc3, 0xee, 0xf5, 0xb4, 0xaf, 0x82, 0x99,
+     0x00, 0xad, 0x47, 0xea, 0x8e, 0x23, 0xc9, 0x64,
+     0x01, 0xac, 0x46, 0xeb, 0x8f, 0x22, 0xc8, 0x65},
+    {0x00, 0x1c, 0x38, 0x24, 0x70, 0x6c, 0x48, 0x54,
+     0xe0, 0xfc, 0xd8, 0xc4, 0x90, 0x8c, 0xa8, 0xb4,
+     0x00, 0xdd, 0xa7, 0x7a, 0x53, 0x8e, 0xf4, 0x29,
+     0xa6, 0x7b, 0x01, 0xdc, 0xf5, 0x28, 0x52, 0x8f},
+    {0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53,
+     0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb,
+     0x00, 0xcd, 0x87, 0x4a, 0x13, 0xde, 0x94, 0x59,
+     0x26, 0xeb, 0xa1, 0x6c, 0x35, 0xf8, 0xb2, 0x7f},
+    {0x00, 0x1e, 0x3c, 0x22, 0x78, 0x66, 0x44, 0x5a,
+     0xf0, 0xee, 0xcc, 0xd2, 0x88, 0x96, 0xb4, 0xaa,
+     0x00, 0xfd, 0xe7, 0x1a, 0xd3, 0x2e, 0x34, 0xc9,
+     0xbb, 0x46, 0x5c, 0xa1, 0x68, 0x95, 0x8f, 0x72},
+    {0x00, 0x1f, 0x3e, 0x21, 0x7c, 0x63, 0x42, 0x5d,
+     0xf8, 0xe7, 0xc6, 0xd9, 0x84, 0x9b, 0xba, 0xa5,
+     0x00, 0xed, 0xc7, 0x2a, 0x93, 0x7e, 0x54, 0xb9,
+     0x3b, 0xd6, 0xfc, 0x11, 0xa8, 0x45, 0x6f, 0x82},
+    {0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0,
+     0x1d, 0x3d, 0x5d, 0x7d, 0x9d, 0xbd, 0xdd, 0xfd,
+     0x00, 0x3a, 0x74, 0x4e, 0xe8, 0xd2, 0x9c, 0xa6,
+     0xcd, 0xf7, 0xb9, 0x83, 0x25, 0x1f, 0x51, 0x6b},
+    {0x00, 0x21, 0x42, 0x63, 0x84, 0xa5, 0xc6, 0xe7,
+     0x15, 0x34, 0x57, 0x76, 0x91, 0xb0, 0xd3, 0xf2,
+     0x00, 0x2a, 0x54, 0x7e, 0xa8, 0x82, 0xfc, 0xd6,
+     0x4d, 0x67, 0x19, 0x33, 0xe5, 0xcf, 0xb1, 0x9b},
+    {0x00, 0x22, 0x44, 0x66, 0x88, 0xaa, 0xcc, 0xee,
+     0x0d, 0x2f, 0x49, 0x6b, 0x85, 0xa7, 0xc1, 0xe3,
+     0x00, 0x1a, 0x34, 0x2e, 0x68, 0x72, 0x5c, 0x46,
+     0xd0, 0xca, 0xe4, 0xfe, 0xb8, 0xa2, 0x8c, 0x96},
+    {0x00, 0x23, 0x46, 0x65, 0x8c, 0xaf, 0xca, 0xe9,
+     0x05, 0x26, 0x43, 0x60, 0x89, 0xaa, 0xcf, 0xec,
+     0x00, 0x0a, 0x14, 0x1e, 0x28, 0x22, 0x3c, 0x36,
+     0x50, 0x5a, 0x44, 0x4e, 0x78, 0x72, 0x6c, 0x66},
+    {0x00, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0xd8, 0xfc,
+     0x3d, 0x19, 0x75, 0x51, 0xad, 0x89, 0xe5, 0xc1,
+     0x00, 0x7a, 0xf4, 0x8e, 0xf5, 0x8f, 0x01, 0x7b,
+     0xf7, 0x8d, 0x03, 0x79, 0x02, 0x78, 0xf6, 0x8c},
+    {0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb1, 0xde, 0xfb,
+     0x35, 0x10, 0x7f, 0x5a, 0xa1, 0x84, 0xeb, 0xce,
+     0x00, 0x6a, 0xd4, 0xbe, 0xb5, 0xdf, 0x61, 0x0b,
+     0x77, 0x1d, 0xa3, 0xc9, 0xc2, 0xa8, 0x16, 0x7c},
+    {0x00, 0x26, 0x4c, 0x6a, 0x98, 0xbe, 0xd4, 0xf2,
+     0x2d, 0x0b, 0x61, 0x47, 0xb5, 0x93, 0xf9, 0xdf,
+     0x00, 0x5a, 0xb4, 0xee, 0x75, 0x2f, 0xc1, 0x9b,
+     0xea, 0xb0, 0x5e, 0x04, 0x9f, 0xc5, 0x2b, 0x71},
+    {0x00, 0x27, 0x4e, 0x69, 0x9c, 0xbb, 0xd2, 0xf5,
+     0x25, 0x02, 0x6b, 0x4c, 0xb9, 0x9e, 0xf7, 0xd0,
+     0x00, 0x4a, 0x94, 0xde, 0x35, 0x7f, 0xa1, 0xeb,
+     0x6a, 0x20, 0xfe, 0xb4, 0x5f, 0x15, 0xcb, 0x81},
+    {0x00, 0x28, 0x50, 0x78, 0xa0, 0x88, 0xf0, 0xd8,
+     0x5d, 0x75, 0x0d, 0x25, 0xfd, 0xd5, 0xad, 0x85,
+     0x00, 0xba, 0x69, 0xd3, 0xd2, 0x68, 0xbb, 0x01,
+     0xb9, 0x03, 0xd0, 0x6a, 0x6b, 0xd1, 0x02, 0xb8},
+    {0x00, 0x29, 0x52, 0x7b, 0xa4, 0x8d, 0xf6, 0xdf,
+     0x55, 0x7c, 0x07, 0x2e, 0xf1, 0xd8, 0xa3, 0x8a,
+     0x00, 0xaa, 0x49, 0xe3, 0x92, 0x38, 0xdb, 0x71,
+     0x39, 0x93, 0x70, 0xda, 0xab, 0x01, 0xe2, 0x48},
+    {0x00, 0x2a, 0x54, 0x7e, 0xa8, 0x82, 0xfc, 0xd6,
+     0x4d, 0x67, 0x19, 0x33, 0xe5, 0xcf, 0xb1, 0x9b,
+     0x00, 0x9a, 0x29, 0xb3, 0x52, 0xc8, 0x7b, 0xe1,
+     0xa4, 0x3e, 0x8d, 0x17, 0xf6, 0x6c, 0xdf, 0x45},
+    {0x00, 0x2b, 0x56, 0x7d, 0xac, 0x87, 0xfa, 0xd1,
+     0x45, 0x6e, 0x13, 0x38, 0xe9, 0xc2, 0xbf, 0x94,
+     0x00, 0x8a, 0x09, 0x83, 0x12, 0x98, 0x1b, 0x91,
+     0x24, 0xae, 0x2d, 0xa7, 0x36, 0xbc, 0x3f, 0xb5},
+    {0x00, 0x2c, 0x58, 0x74, 0xb0, 0x9c, 0xe8, 0xc4,
+     0x7d, 0x51, 0x25, 0x09, 0xcd, 0xe1, 0x95, 0xb9,
+     0x00, 0xfa, 0xe9, 0x13, 0xcf, 0x35, 0x26, 0xdc,
+     0x83, 0x79, 0x6a, 0x90, 0x4c, 0xb6, 0xa5, 0x5f},
+    {0x00, 0x2d, 0x5a, 0x77, 0xb4, 0x99, 0xee, 0xc3,
+     0x75, 0x58, 0x2f, 0x02, 0xc1, 0xec, 0x9b, 0xb6,
+     0x00, 0xea, 0xc9, 0x23, 0x8f, 0x65, 0x46, 0xac,
+     0x03, 0xe9, 0xca, 0x20, 0x8c, 0x66, 0x45, 0xaf},
+    {0x00, 0x2e, 0x5c, 0x72, 0xb8, 0x96, 0xe4, 0xca,
+     0x6d, 0x43, 0x31, 0x1f, 0xd5, 0xfb, 0x89, 0xa7,
+     0x00, 0xda, 0xa9, 0x73, 0x4f, 0x95, 0xe6, 0x3c,
+     0x9e, 0x44, 0x37, 0xed, 0xd1, 0x0b, 0x78, 0xa2},
+    {0x00, 0x2f, 0x5e, 0x71, 0xbc, 0x93, 0xe2, 0xcd,
+     0x65, 0x4a, 0x3b, 0x14, 0xd9, 0xf6, 0x87, 0xa8,
+     0x00, 0xca, 0x89, 0x43, 0x0f, 0xc5, 0x86, 0x4c,
+     0x1e, 0xd4, 0x97, 0x5d, 0x11, 0xdb, 0x98, 0x52},
+    {0x00, 0x30, 0x60, 0x50, 0xc0, 0xf0, 0xa0, 0x90,
+     0x9d, 0xad, 0xfd, 0xcd, 0x5d, 0x6d, 0x3d, 0x0d,
+     0x00, 0x27, 0x4e, 0x69, 0x9c, 0xbb, 0xd2, 0xf5,
+     0x25, 0x02, 0x6b, 0x4c, 0xb9, 0x9e, 0xf7, 0xd0},
+    {0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97,
+     0x95, 0xa4, 0xf7, 0xc6, 0x51, 0x60, 0x33, 0x02,
+     0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85,
+     0xa5, 0x92, 0xcb, 0xfc, 0x79, 0x4e, 0x17, 0x20},
+    {0x00, 0x32, 0x64, 0x56, 0xc8, 0xfa, 0xac, 0x9e,
+     0x8d, 0xbf, 0xe9, 0xdb, 0x45, 0x77, 0x21, 0x13,
+     0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+     0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d},
+    {0x00, 0x33, 0x66, 0x55, 0xcc, 0xff, 0xaa, 0x99,
+     0x85, 0xb6, 0xe3, 0xd0, 0x49, 0x7a, 0x2f, 0x1c,
+     0x00, 0x17, 0x2e, 0x39, 0x5c, 0x4b, 0x72, 0x65,
+     0xb8, 0xaf, 0x96, 0x81, 0xe4, 0xf3, 0xca, 0xdd},
+    {0x00, 0x34, 0x68, 0x5c, 0xd0, 0xe4, 0xb8, 0x8c,
+     0xbd, 0x89, 0xd5, 0xe1, 0x6d, 0x59, 0x05, 0x31,
+     0x00, 0x67, 0xce, 0xa9, 0x81, 0xe6, 0x4f, 0x28,
+     0x1f, 0x78, 0xd1, 0xb6, 0x9e, 0xf9, 0x50, 0x37},
+    {0x00, 0x35, 0x6a, 0x5f, 0xd4, 0xe1, 0xbe, 0x8b,
+     0xb5, 0x80, 0xdf, 0xea, 0x61, 0x54, 0x0b, 0x3e,
+     0x00, 0x77, 0xee, 0x99, 0xc1, 0xb6, 0x2f, 0x58,
+     0x9f, 0xe8, 0x71, 0x06, 0x5e, 0x29, 0xb0, 0xc7},
+    {0x00, 0x36, 0x6c, 0x5a, 0xd8, 0xee, 0xb4, 0x82,
+     0xad, 0x9b, 0xc1, 0xf7, 0x75, 0x43, 0x19, 0x2f,
+     0x00, 0x47, 0x8e, 0xc9, 0x01, 0x46, 0x8f, 0xc8,
+     0x02, 0x45, 0x8c, 0xcb, 0x03, 0x44, 0x8d, 0xca},
+    {0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85,
+     0xa5, 0x92, 0xcb, 0xfc, 0x79, 0x4e, 0x17, 0x20,
+     0x00, 0x57, 0xae, 0xf9, 0x41, 0x16, 0xef, 0xb8,
+     0x82, 0xd5, 0x2c, 0x7b, 0xc3, 0x94, 0x6d, 0x3a},
+    {0x00, 0x38, 0x70, 0x48, 0xe0, 0xd8, 0x90, 0xa8,
+     0xdd, 0xe5, 0xad, 0x95, 0x3d, 0x05, 0x4d, 0x75,
+     0x00, 0xa7, 0x53, 0xf4, 0xa6, 0x01, 0xf5, 0x52,
+     0x51, 0xf6, 0x02, 0xa5, 0xf7, 0x50, 0xa4, 0x03},
+    {0x00, 0x39, 0x72, 0x4b, 0xe4, 0xdd, 0x96, 0xaf,
+     0xd5, 0xec, 0xa7, 0x9e, 0x31, 0x08, 0x43, 0x7a,
+     0x00, 0xb7, 0x73, 0xc4, 0xe6, 0x51, 0x95, 0x22,
+     0xd1, 0x66, 0xa2, 0x15, 0x37, 0x80, 0x44, 0xf3},
+    {0x00, 0x3a, 0x74, 0x4e, 0xe8, 0xd2, 0x9c, 0xa6,
+     0xcd, 0xf7, 0xb9, 0x83, 0x25, 0x1f, 0x51, 0x6b,
+     0x00, 0x87, 0x13, 0x94, 0x26, 0xa1, 0x35, 0xb2,
+     0x4c, 0xcb, 0x5f, 0xd8, 0x6a, 0xed, 0x79, 0xfe},
+    {0x00, 0x3b, 0x76, 0x4d, 0xec, 0xd7, 0x9a, 0xa1,
+     0xc5, 0xfe, 0xb3, 0x88, 0x29, 0x12, 0x5f, 0x64,
+     0x00, 0x97, 0x33, 0xa4, 0x66, 0xf1, 0x55, 0xc2,
+     0xcc, 0x5b, 0xff, 0x68, 0xaa, 0x3d, 0x99, 0x0e},
+    {0x00, 0x3c, 0x78, 0x44, 0xf0, 0xcc, 0x88, 0xb4,
+     0xfd, 0xc1, 0x85, 0xb9, 0x0d, 0x31, 0x75, 0x49,
+     0x00, 0xe7, 0xd3, 0x34, 0xbb, 0x5c, 0x68, 0x8f,
+     0x6b, 0x8c, 0xb8, 0x5f, 0xd0, 0x37, 0x03, 0xe4},
+    {0x00, 0x3d, 0x7a, 0x47, 0xf4, 0xc9, 0x8e, 0xb3,
+     0xf5, 0xc8, 0x8f, 0xb2, 0x01, 0x3c, 0x7b, 0x46,
+     0x00, 0xf7, 0xf3, 0x04, 0xfb, 0x0c, 0x08, 0xff,
+     0xeb, 0x1c, 0x18, 0xef, 0x10, 0xe7, 0xe3, 0x14},
+    {0x00, 0x3e, 0x7c, 0x42, 0xf8, 0xc6, 0x84, 0xba,
+     0xed, 0xd3, 0x91, 0xaf, 0x15, 0x2b, 0x69, 0x57,
+     0x00, 0xc7, 0x93, 0x54, 0x3b, 0xfc, 0xa8, 0x6f,
+     0x76, 0xb1, 0xe5, 0x22, 0x4d, 0x8a, 0xde, 0x19},
+    {0x00, 0x3f, 0x7e, 0x41, 0xfc, 0xc3, 0x82, 0xbd,
+     0xe5, 0xda, 0x9b, 0xa4, 0x19, 0x26, 0x67, 0x58,
+     0x00, 0xd7, 0xb3, 0x64, 0x7b, 0xac, 0xc8, 0x1f,
+     0xf6, 0x21, 0x45, 0x92, 0x8d, 0x5a, 0x3e, 0xe9},
+    {0x00, 0x40, 0x80, 0xc0, 0x1d, 0x5d, 0x9d, 0xdd,
+     0x3a, 0x7a, 0xba, 0xfa, 0x27, 0x67, 0xa7, 0xe7,
+     0x00, 0x74, 0xe8, 0x9c, 0xcd, 0xb9, 0x25, 0x51,
+     0x87, 0xf3, 0x6f, 0x1b, 0x4a, 0x3e, 0xa2, 0xd6},
+    {0x00, 0x41, 0x82, 0xc3, 0x19, 0x58, 0x9b, 0xda,
+     0x32, 0x73, 0xb0, 0xf1, 0x2b, 0x6a, 0xa9, 0xe8,
+     0x00, 0x64, 0xc8, 0xac, 0x8d, 0xe9, 0x45, 0x21,
+     0x07, 0x63, 0xcf, 0xab, 0x8a, 0xee, 0x42, 0x26},
+    {0x00, 0x42, 0x84, 0xc6, 0x15, 0x57, 0x91, 0xd3,
+     0x2a, 0x68, 0xae, 0xec, 0x3f, 0x7d, 0xbb, 0xf9,
+     0x00, 0x54, 0xa8, 0xfc, 0x4d, 0x19, 0xe5, 0xb1,
+     0x9a, 0xce, 0x32, 0x66, 0xd7, 0x83, 0x7f, 0x2b},
+    {0x00, 0x43, 0x86, 0xc5, 0x11, 0x52, 0x97, 0xd4,
+     0x22, 0x61, 0xa4, 0xe7, 0x33, 0x70, 0xb5, 0xf6,
+     0x00, 0x44, 0x88, 0xcc, 0x0d, 0x49, 0x85, 0xc1,
+     0x1a, 0x5e, 0x92, 0xd6, 0x17, 0x53, 0x9f, 0xdb},
+    {0x00, 0x44, 0x88, 0xcc, 0x0d, 0x49, 0x85, 0xc1,
+     0x1a, 0x5e, 0x92, 0xd6, 0x17, 0x53, 0x9f, 0xdb,
+     0x00, 0x34, 0x68, 0x5c, 0xd0, 0xe4, 0xb8, 0x8c,
+     0xbd, 0x89, 0xd5, 0xe1, 0x6d, 0x59, 0x05, 0x31},
+    {0x00, 0x45, 0x8a, 0xcf, 0x09, 0x4c, 0x83, 0xc6,
+     0x12, 0x57, 0x98, 0xdd, 0x1b, 0x5e, 0x91, 0xd4,
+     0x00, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0xd8, 0xfc,
+     0x3d, 0x19, 0x75, 0x51, 0xad, 0x89, 0xe5, 0xc1},
+    {0x00, 0x46, 0x8c, 0xca, 0x05, 0x43, 0x89, 0xcf,
+     0x0a, 0x4c, 0x86, 0xc0, 0x0f, 0x49, 0x83, 0xc5,
+     0x00, 0x14, 0x28, 0x3c, 0x50, 0x44, 0x78, 0x6c,
+     0xa0, 0xb4, 0x88, 0x9c, 0xf0, 0xe4, 0xd8, 0xcc},
+    {0x00, 0x47, 0x8e, 0xc9, 0x01, 0x46, 0x8f, 0xc8,
+     0x02, 0x45, 0x8c, 0xcb, 0x03, 0x44, 0x8d, 0xca,
+     0x00, 0x04, 0x08, 0x0c, 0x10, 0x14, 0x18, 0x1c,
+     0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38, 0x3c},
+    {0x00, 0x48, 0x90, 0xd8, 0x3d, 0x75, 0xad, 0xe5,
+     0x7a, 0x32, 0xea, 0xa2, 0x47, 0x0f, 0xd7, 0x9f,
+     0x00, 0xf4, 0xf5, 0x01, 0xf7, 0x03, 0x02, 0xf6,
+     0xf3, 0x07, 0x06, 0xf2, 0x04, 0xf0, 0xf1, 0x05},
+    {0x00, 0x49, 0x92, 0xdb, 0x39, 0x70, 0xab, 0xe2,
+     0x72, 0x3b, 0xe0, 0xa9, 0x4b, 0x02, 0xd9, 0x90,
+     0x00, 0xe4, 0xd5, 0x31, 0xb7, 0x53, 0x62, 0x86,
+     0x73, 0x97, 0xa6, 0x42, 0xc4, 0x20, 0x11, 0xf5},
+    {0x00, 0x4a, 0x94, 0xde, 0x35, 0x7f, 0xa1, 0xeb,
+     0x6a, 0x20, 0xfe, 0xb4, 0x5f, 0x15, 0xcb, 0x81,
+     0x00, 0xd4, 0xb5, 0x61, 0x77, 0xa3, 0xc2, 0x16,
+     0xee, 0x3a, 0x5b, 0x8f, 0x99, 0x4d, 0x2c, 0xf8},
+    {0x00, 0x4b, 0x96, 0xdd, 0x31, 0x7a, 0xa7, 0xec,
+     0x62, 0x29, 0xf4, 0xbf, 0x53, 0x18, 0xc5, 0x8e,
+     0x00, 0xc4, 0x95, 0x51, 0x37, 0xf3, 0xa2, 0x66,
+     0x6e, 0xaa, 0xfb, 0x3f, 0x59, 0x9d, 0xcc, 0x08},
+    {0x00, 0x4c, 0x98, 0xd4, 0x2d, 0x61, 0xb5, 0xf9,
+     0x5a, 0x16, 0xc2, 0x8e, 0x77, 0x3b, 0xef, 0xa3,
+     0x00, 0xb4, 0x75, 0xc1, 0xea, 0x5e, 0x9f, 0x2b,
+     0xc9, 0x7d, 0xbc, 0x08, 0x23, 0x97, 0x56, 0xe2},
+    {0x00, 0x4d, 0x9a, 0xd7, 0x29, 0x64, 0xb3, 0xfe,
+     0x52, 0x1f, 0xc8, 0x85, 0x7b, 0x36, 0xe1, 0xac,
+     0x00, 0xa4, 0x55, 0xf1, 0xaa, 0x0e, 0xff, 0x5b,
+     0x49, 0xed, 0x1c, 0xb8, 0xe3, 0x47, 0xb6, 0x12},
+    {0x00, 0x4e, 0x9c, 0xd2, 0x25, 0x6b, 0xb9, 0xf7,
+     0x4a, 0x04, 0xd6, 0x98, 0x6f, 0x21, 0xf3, 0xbd,
+     0x00, 0x94, 0x35, 0xa1, 0x6a, 0xfe, 0x5f, 0xcb,
+     0xd4, 0x40, 0xe1, 0x75, 0xbe, 0x2a, 0x8b, 0x1f},
+    {0x00, 0x4f, 0x9e, 0xd1, 0x21, 0x6e, 0xbf, 0xf0,
+     0x42, 0x0d, 0xdc, 0x93, 0x63, 0x2c, 0xfd, 0xb2,
+     0x00, 0x84, 0x15, 0x91, 0x2a, 0xae, 0x3f, 0xbb,
+     0x54, 0xd0, 0x41, 0xc5, 0x7e, 0xfa, 0x6b, 0xef},
+    {0x00, 0x50, 0xa0, 0xf0, 0x5d, 0x0d, 0xfd, 0xad,
+     0xba, 0xea, 0x1a, 0x4a, 0xe7, 0xb7, 0x47, 0x17,
+     0x00, 0x69, 0xd2, 0xbb, 0xb9, 0xd0, 0x6b, 0x02,
+     0x6f, 0x06, 0xbd, 0xd4, 0xd6, 0xbf, 0x04, 0x6d},
+    {0x00, 0x51, 0xa2, 0xf3, 0x59, 0x08, 0xfb, 0xaa,
+     0xb2, 0xe3, 0x10, 0x41, 0xeb, 0xba, 0x49, 0x18,
+     0x00, 0x79, 0xf2, 0x8b, 0xf9, 0x80, 0x0b, 0x72,
+     0xef, 0x96, 0x1d, 0x64, 0x16, 0x6f, 0xe4, 0x9d},
+    {0x00, 0x52, 0xa4, 0xf6, 0x55, 0x07, 0xf1, 0xa3,
+     0xaa, 0xf8, 0x0e, 0x5c, 0xff, 0xad, 0x5b, 0x09,
+     0x00, 0x49, 0x92, 0xdb, 0x39, 0x70, 0xab, 0xe2,
+     0x72, 0x3b, 0xe0, 0xa9, 0x4b, 0x02, 0xd9, 0x90},
+    {0x00, 0x53, 0xa6, 0xf5, 0x51, 0x02, 0xf7, 0xa4,
+     0xa2, 0xf1, 0x04, 0x57, 0xf3, 0xa0, 0x55, 0x06,
+     0x00, 0x59, 0xb2, 0xeb, 0x79, 0x20, 0xcb, 0x92,
+     0xf2, 0xab, 0x40, 0x19, 0x8b, 0xd2, 0x39, 0x60},
+    {0x00, 0x54, 0xa8, 0xfc, 0x4d, 0x19, 0xe5, 0xb1,
+     0x9a, 0xce, 0x32, 0x66, 0xd7, 0x83, 0x7f, 0x2b,
+     0x00, 0x29, 0x52, 0x7b, 0xa4, 0x8d, 0xf6, 0xdf,
+     0x55, 0x7c, 0x07, 0x2e, 0xf1, 0xd8, 0xa3, 0x8a},
+    {0x00, 0x55, 0xaa, 0xff, 0x49, 0x1c, 0xe3, 0xb6,
+     0x92, 0xc7, 0x38, 0x6d, 0xdb, 0x8e, 0x71, 0x24,
+     0x00, 0x39, 0x72, 0x4b, 0xe4, 0xdd, 0x96, 0xaf,
+     0xd5, 0xec, 0xa7, 0x9e, 0x31, 0x08, 0x43, 0x7a},
+    {0x00, 0x56, 0xac, 0xfa, 0x45, 0x13, 0xe9, 0xbf,
+     0x8a, 0xdc, 0x26, 0x70, 0xcf, 0x99, 0x63, 0x35,
+     0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f,
+     0x48, 0x41, 0x5a, 0x53, 0x6c, 0x65, 0x7e, 0x77},
+    {0x00, 0x57, 0xae, 0xf9, 0x41, 0x16, 0xef, 0xb8,
+     0x82, 0xd5, 0x2c, 0x7b, 0xc3, 0x94, 0x6d, 0x3a,
+     0x00, 0x19, 0x32, 0x2b, 0x64, 0x7d, 0x56, 0x4f,
+     0xc8, 0xd1, 0xfa, 0xe3, 0xac, 0xb5, 0x9e, 0x87},
+    {0x00, 0x58, 0xb0, 0xe8, 0x7d, 0x25, 0xcd, 0x95,
+     0xfa, 0xa2, 0x4a, 0x12, 0x87, 0xdf, 0x37, 0x6f,
+     0x00, 0xe9, 0xcf, 0x26, 0x83, 0x6a, 0x4c, 0xa5,
+     0x1b, 0xf2, 0xd4, 0x3d, 0x98, 0x71, 0x57, 0xbe},
+    {0x00, 0x59, 0xb2, 0xeb, 0x79, 0x20, 0xcb, 0x92,
+     0xf2, 0xab, 0x40, 0x19, 0x8b, 0xd2, 0x39, 0x60,
+     0x00, 0xf9, 0xef, 0x16, 0xc3, 0x3a, 0x2c, 0xd5,
+     0x9b, 0x62, 0x74, 0x8d, 0x58, 0xa1, 0xb7, 0x4e},
+    {0x00, 0x5a, 0xb4, 0xee, 0x75, 0x2f, 0xc1, 0x9b,
+     0xea, 0xb0, 0x5e, 0x04, 0x9f, 0xc5, 0x2b, 0x71,
+     0x00, 0xc9, 0x8f, 0x46, 0x03, 0xca, 0x8c, 0x45,
+     0x06, 0xcf, 0x89, 0x40, 0x05, 0xcc, 0x8a, 0x43},
+    {0x00, 0x5b, 0xb6, 0xed, 0x71, 0x2a, 0xc7, 0x9c,
+     0xe2, 0xb9, 0x54, 0x0f, 0x93, 0xc8, 0x25, 0x7e,
+     0x00, 0xd9, 0xaf, 0x76, 0x43, 0x9a, 0xec, 0x35,
+     0x86, 0x5f, 0x29, 0xf0, 0xc5, 0x1c, 0x6a, 0xb3},
+    {0x00, 0x5c, 0xb8, 0xe4, 0x6d, 0x31, 0xd5, 0x89,
+     0xda, 0x86, 0x62, 0x3e, 0xb7, 0xeb, 0x0f, 0x53,
+     0x00, 0xa9, 0x4f, 0xe6, 0x9e, 0x37, 0xd1, 0x78,
+     0x21, 0x88, 0x6e, 0xc7, 0xbf, 0x16, 0xf0, 0x59},
+    {0x00, 0x5d, 0xba, 0xe7, 0x69, 0x34, 0xd3, 0x8e,
+     0xd2, 0x8f, 0x68, 0x35, 0xbb, 0xe6, 0x01, 0x5c,
+     0x00, 0xb9, 0x6f, 0xd6, 0xde, 0x67, 0xb1, 0x08,
+     0xa1, 0x18, 0xce, 0x77, 0x7f, 0xc6, 0x10, 0xa9},
+    {0x00, 0x5e, 0xbc, 0xe2, 0x65, 0x3b, 0xd9, 0x87,
+     0xca, 0x94, 0x76, 0x28, 0xaf, 0xf1, 0x13, 0x4d,
+     0x00, 0x89, 0x0f, 0x86, 0x1e, 0x97, 0x11, 0x98,
+     0x3c, 0xb5, 0x33, 0xba, 0x22, 0xab, 0x2d, 0xa4},
+    {0x00, 0x5f, 0xbe, 0xe1, 0x61, 0x3e, 0xdf, 0x80,
+     0xc2, 0x9d, 0x7c, 0x23, 0xa3, 0xfc, 0x1d, 0x42,
+     0x00, 0x99, 0x2f, 0xb6, 0x5e, 0xc7, 0x71, 0xe8,
+     0xbc, 0x25, 0x93, 0x0a, 0xe2, 0x7b, 0xcd, 0x54},
+    {0x00, 0x60, 0xc0, 0xa0, 0x9d, 0xfd, 0x5d, 0x3d,
+     0x27, 0x47, 0xe7, 0x87, 0xba, 0xda, 0x7a, 0x1a,
+     0x00, 0x4e, 0x9c, 0xd2, 0x25, 0x6b, 0xb9, 0xf7,
+     0x4a, 0x04, 0xd6, 0x98, 0x6f, 0x21, 0xf3, 0xbd},
+    {0x00, 0x61, 0xc2, 0xa3, 0x99, 0xf8, 0x5b, 0x3a,
+     0x2f, 0x4e, 0xed, 0x8c, 0xb6, 0xd7, 0x74, 0x15,
+     0x00, 0x5e, 0xbc, 0xe2, 0x65, 0x3b, 0xd9, 0x87,
+     0xca, 0x94, 0x76, 0x28, 0xaf, 0xf1, 0x13, 0x4d},
+    {0x00, 0x62, 0xc4, 0xa6, 0x95, 0xf7, 0x51, 0x33,
+     0x37, 0x55, 0xf3, 0x91, 0xa2, 0xc0, 0x66, 0x04,
+     0x00, 0x6e, 0xdc, 0xb2, 0xa5, 0xcb, 0x79, 0x17,
+     0x57, 0x39, 0x8b, 0xe5, 0xf2, 0x9c, 0x2e, 0x40},
+    {0x00, 0x63, 0xc6, 0xa5, 0x91, 0xf2, 0x57, 0x34,
+     0x3f, 0x5c, 0xf9, 0x9a, 0xae, 0xcd, 0x68, 0x0b,
+     0x00, 0x7e, 0xfc, 0x82, 0xe5, 0x9b, 0x19, 0x67,
+     0xd7, 0xa9, 0x2b, 0x55, 0x32, 0x4c, 0xce, 0xb0},
+    {0x00, 0x64, 0xc8, 0xac, 0x8d, 0xe9, 0x45, 0x21,
+     0x07, 0x63, 0xcf, 0xab, 0x8a, 0xee, 0x42, 0x26,
+     0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a,
+     0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a},
+    {0x00, 0x65, 0xca, 0xaf, 0x89, 0xec, 0x43, 0x26,
+     0x0f, 0x6a, 0xc5, 0xa0, 0x86, 0xe3, 0x4c, 0x29,
+     0x00, 0x1e, 0x3c, 0x22, 0x78, 0x66, 0x44, 0x5a,
+     0xf0, 0xee, 0xcc, 0xd2, 0x88, 0x96, 0xb4, 0xaa},
+    {0x00, 0x66, 0xcc, 0xaa, 0x85, 0xe3, 0x49, 0x2f,
+     0x17, 0x71, 0xdb, 0xbd, 0x92, 0xf4, 0x5e, 0x38,
+     0x00, 0x2e, 0x5c, 0x72, 0xb8, 0x96, 0xe4, 0xca,
+     0x6d, 0x43, 0x31, 0x1f, 0xd5, 0xfb, 0x89, 0xa7},
+    {0x00, 0x67, 0xce, 0xa9, 0x81, 0xe6, 0x4f, 0x28,
+     0x1f, 0x78, 0xd1, 0xb6, 0x9e, 0xf9, 0x50, 0x37,
+     0x00, 0x3e, 0x7c, 0x42, 0xf8, 0xc6, 0x84, 0xba,
+     0xed, 0xd3, 0x91, 0xaf, 0x15, 0x2b, 0x69, 0x57},
+    {0x00, 0x68, 0xd0, 0xb8, 0xbd, 0xd5, 0x6d, 0x05,
+     0x67, 0x0f, 0xb7, 0xdf, 0xda, 0xb2, 0x0a, 0x62,
+     0x00, 0xce, 0x81, 0x4f, 0x1f, 0xd1, 0x9e, 0x50,
+     0x3e, 0xf0, 0xbf, 0x71, 0x21, 0xef, 0xa0, 0x6e},
+    {0x00, 0x69, 0xd2, 0xbb, 0xb9, 0xd0, 0x6b, 0x02,
+     0x6f, 0x06, 0xbd, 0xd4, 0xd6, 0xbf, 0x04, 0x6d,
+     0x00, 0xde, 0xa1, 0x7f, 0x5f, 0x81, 0xfe, 0x20,
+     0xbe, 0x60, 0x1f, 0xc1, 0xe1, 0x3f, 0x40, 0x9e},
+    {0x00, 0x6a, 0xd4, 0xbe, 0xb5, 0xdf, 0x61, 0x0b,
+     0x77, 0x1d, 0xa3, 0xc9, 0xc2, 0xa8, 0x16, 0x7c,
+     0x00, 0xee, 0xc1, 0x2f, 0x9f, 0x71, 0x5e, 0xb0,
+     0x23, 0xcd, 0xe2, 0x0c, 0xbc, 0x52, 0x7d, 0x93},
+    {0x00, 0x6b, 0xd6, 0xbd, 0xb1, 0xda, 0x67, 0x0c,
+     0x7f, 0x14, 0xa9, 0xc2, 0xce, 0xa5, 0x18, 0x73,
+     0x00, 0xfe, 0xe1, 0x1f, 0xdf, 0x21, 0x3e, 0xc0,
+     0xa3, 0x5d, 0x42, 0xbc, 0x7c, 0x82, 0x9d, 0x63},
+    {0x00, 0x6c, 0xd8, 0xb4, 0xad, 0xc1, 0x75, 0x19,
+     0x47, 0x2b, 0x9f, 0xf3, 0xea, 0x86, 0x32, 0x5e,
+     0x00, 0x8e, 0x01, 0x8f, 0x02, 0x8c, 0x03, 0x8d,
+     0x04, 0x8a, 0x05, 0x8b, 0x06, 0x88, 0x07, 0x89},
+    {0x00, 0x6d, 0xda, 0xb7, 0xa9, 0xc4, 0x73, 0x1e,
+     0x4f, 0x22, 0x95, 0xf8, 0xe6, 0x8b, 0x3c, 0x51,
+     0x00, 0x9e, 0x21, 0xbf, 0x42, 0xdc, 0x63, 0xfd,
+     0x84, 0x1a, 0xa5, 0x3b, 0xc6, 0x58, 0xe7, 0x79},
+    {0x00, 0x6e, 0xdc, 0xb2, 0xa5, 0xcb, 0x79, 0x17,
+     0x57, 0x39, 0x8b, 0xe5, 0xf2, 0x9c, 0x2e, 0x40,
+     0x00, 0xae, 0x41, 0xef, 0x82, 0x2c, 0xc3, 0x6d,
+     0x19, 0xb7, 0x58, 0xf6, 0x9b, 0x35, 0xda, 0x74},
+    {0x00, 0x6f, 0xde, 0xb1, 0xa1, 0xce, 0x7f, 0x10,
+     0x5f, 0x30, 0x81, 0xee, 0xfe, 0x91, 0x20, 0x4f,
+     0x00, 0xbe, 0x61, 0xdf, 0xc2, 0x7c, 0xa3, 0x1d,
+     0x99, 0x27, 0xf8, 0x46, 0x5b, 0xe5, 0x3a, 0x84},
+    {0x00, 0x70, 0xe0, 0x90, 0xdd, 0xad, 0x3d, 0x4d,
+     0xa7, 0xd7, 0x47, 0x37, 0x7a, 0x0a, 0x9a, 0xea,
+     0x00, 0x53, 0xa6, 0xf5, 0x51, 0x02, 0xf7, 0xa4,
+     0xa2, 0xf1, 0x04, 0x57, 0xf3, 0xa0, 0x55, 0x06},
+    {0x00, 0x71, 0xe2, 0x93, 0xd9, 0xa8, 0x3b, 0x4a,
+     0xaf, 0xde, 0x4d, 0x3c, 0x76, 0x07, 0x94, 0xe5,
+     0x00, 0x43, 0x86, 0xc5, 0x11, 0x52, 0x97, 0xd4,
+     0x22, 0x61, 0xa4, 0xe7, 0x33, 0x70, 0xb5, 0xf6},
+    {0x00, 0x72, 0xe4, 0x96, 0xd5, 0xa7, 0x31, 0x43,
+     0xb7, 0xc5, 0x53, 0x21, 0x62, 0x10, 0x86, 0xf4,
+     0x00, 0x73, 0xe6, 0x95, 0xd1, 0xa2, 0x37, 0x44,
+     0xbf, 0xcc, 0x59, 0x2a, 0x6e, 0x1d, 0x88, 0xfb},
+    {0x00, 0x73, 0xe6, 0x95, 0xd1, 0xa2, 0x37, 0x44,
+     0xbf, 0xcc, 0x59, 0x2a, 0x6e, 0x1d, 0x88, 0xfb,
+     0x00, 0x63, 0xc6, 0xa5, 0x91, 0xf2, 0x57, 0x34,
+     0x3f, 0x5c, 0xf9, 0x9a, 0xae, 0xcd, 0x68, 0x0b},
+    {0x00, 0x74, 0xe8, 0x9c, 0xcd, 0xb9, 0x25, 0x51,
+     0x87, 0xf3, 0x6f, 0x1b, 0x4a, 0x3e, 0xa2, 0xd6,
+     0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79,
+     0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1},
+    {0x00, 0x75, 0xea, 0x9f, 0xc9, 0xbc, 0x23, 0x56,
+     0x8f, 0xfa, 0x65, 0x10, 0x46, 0x33, 0xac, 0xd9,
+     0x00, 0x03, 0x06, 0x05, 0x0c, 0x0f, 0x0a, 0x09,
+     0x18, 0x1b, 0x1e, 0x1d, 0x14, 0x17, 0x12, 0x11},
+    {0x00, 0x76, 0xec, 0x9a, 0xc5, 0xb3, 0x29, 0x5f,
+     0x97, 0xe1, 0x7b, 0x0d, 0x52, 0x24, 0xbe, 0xc8,
+     0x00, 0x33, 0x66, 0x55, 0xcc, 0xff, 0xaa, 0x99,
+     0x85, 0xb6, 0xe3, 0xd0, 0x49, 0x7a, 0x2f, 0x1c},
+    {0x00, 0x77, 0xee, 0x99, 0xc1, 0xb6, 0x2f, 0x58,
+     0x9f, 0xe8, 0x71, 0x06, 0x5e, 0x29, 0xb0, 0xc7,
+     0x00, 0x23, 0x46, 0x65, 0x8c, 0xaf, 0xca, 0xe9,
+     0x05, 0x26, 0x43, 0x60, 0x89, 0xaa, 0xcf, 0xec},
+    {0x00, 0x78, 0xf0, 0x88, 0xfd, 0x85, 0x0d, 0x75,
+     0xe7, 0x9f, 0x17, 0x6f, 0x1a, 0x62, 0xea, 0x92,
+     0x00, 0xd3, 0xbb, 0x68, 0x6b, 0xb8, 0xd0, 0x03,
+     0xd6, 0x05, 0x6d, 0xbe, 0xbd, 0x6e, 0x06, 0xd5},
+    {0x00, 0x79, 0xf2, 0x8b, 0xf9, 0x80, 0x0b, 0x72,
+     0xef, 0x96, 0x1d, 0x64, 0x16, 0x6f, 0xe4, 0x9d,
+     0x00, 0xc3, 0x9b, 0x58, 0x2b, 0xe8, 0xb0, 0x73,
+     0x56, 0x95, 0xcd, 0x0e, 0x7d, 0xbe, 0xe6, 0x25},
+    {0x00, 0x7a, 0xf4, 0x8e, 0xf5, 0x8f, 0x01, 0x7b,
+     0xf7, 0x8d, 0x03, 0x79, 0x02, 0x78, 0xf6, 0x8c,
+     0x00, 0xf3, 0xfb, 0x08, 0xeb, 0x18, 0x10, 0xe3,
+     0xcb, 0x38, 0x30, 0xc3, 0x20, 0xd3, 0xdb, 0x28},
+    {0x00, 0x7b, 0xf6, 0x8d, 0xf1, 0x8a, 0x07, 0x7c,
+     0xff, 0x84, 0x09, 0x72, 0x0e, 0x75, 0xf8, 0x83,
+     0x00, 0xe3, 0xdb, 0x38, 0xab, 0x48, 0x70, 0x93,
+     0x4b, 0xa8, 0x90, 0x73, 0xe0, 0x03, 0x3b, 0xd8},
+    {0x00, 0x7c, 0xf8, 0x84, 0xed, 0x91, 0x15, 0x69,
+     0xc7, 0xbb, 0x3f, 0x43, 0x2a, 0x56, 0xd2, 0xae,
+     0x00, 0x93, 0x3b, 0xa8, 0x76, 0xe5, 0x4d, 0xde,
+     0xec, 0x7f, 0xd7, 0x44, 0x9a, 0x09, 0xa1, 0x32},
+    {0x00, 0x7d, 0xfa, 0x87, 0xe9, 0x94, 0x13, 0x6e,
+     0xcf, 0xb2, 0x35, 0x48, 0x26, 0x5b, 0xdc, 0xa1,
+     0x00, 0x83, 0x1b, 0x98, 0x36, 0xb5, 0x2d, 0xae,
+     0x6c, 0xef, 0x77, 0xf4, 0x5a, 0xd9, 0x41, 0xc2},
+    {0x00, 0x7e, 0xfc, 0x82, 0xe5, 0x9b, 0x19, 0x67,
+     0xd7, 0xa9, 0x2b, 0x55, 0x32, 0x4c, 0xce, 0xb0,
+     0x00, 0xb3, 0x7b, 0xc8, 0xf6, 0x45, 0x8d, 0x3e,
+     0xf1, 0x42, 0x8a, 0x39, 0x07, 0xb4, 0x7c, 0xcf},
+    {0x00, 0x7f, 0xfe, 0x81, 0xe1, 0x9e, 0x1f, 0x60,
+     0xdf, 0xa0, 0x21, 0x5e, 0x3e, 0x41, 0xc0, 0xbf,
+     0x00, 0xa3, 0x5b, 0xf8, 0xb6, 0x15, 0xed, 0x4e,
+     0x71, 0xd2, 0x2a, 0x89, 0xc7, 0x64, 0x9c, 0x3f},
+    {0x00, 0x80, 0x1d, 0x9d, 0x3a, 0xba, 0x27, 0xa7,
+     0x74, 0xf4, 0x69, 0xe9, 0x4e, 0xce, 0x53, 0xd3,
+     0x00, 0xe8, 0xcd, 0x25, 0x87, 0x6f, 0x4a, 0xa2,
+     0x13, 0xfb, 0xde, 0x36, 0x94, 0x7c, 0x59, 0xb1},
+    {0x00, 0x81, 0x1f, 0x9e, 0x3e, 0xbf, 0x21, 0xa0,
+     0x7c, 0xfd, 0x63, 0xe2, 0x42, 0xc3, 0x5d, 0xdc,
+     0x00, 0xf8, 0xed, 0x15, 0xc7, 0x3f, 0x2a, 0xd2,
+     0x93, 0x6b, 0x7e, 0x86, 0x54, 0xac, 0xb9, 0x41},
+    {0x00, 0x82, 0x19, 0x9b, 0x32, 0xb0, 0x2b, 0xa9,
+     0x64, 0xe6, 0x7d, 0xff, 0x56, 0xd4, 0x4f, 0xcd,
+     0x00, 0xc8, 0x8d, 0x45, 0x07, 0xcf, 0x8a, 0x42,
+     0x0e, 0xc6, 0x83, 0x4b, 0x09, 0xc1, 0x84, 0x4c},
+    {0x00, 0x83, 0x1b, 0x98, 0x36, 0xb5, 0x2d, 0xae,
+     0x6c, 0xef, 0x77, 0xf4, 0x5a, 0xd9, 0x41, 0xc2,
+     0x00, 0xd8, 0xad, 0x75, 0x47, 0x9f, 0xea, 0x32,
+     0x8e, 0x56, 0x23, 0xfb, 0xc9, 0x11, 0x64, 0xbc},
+    {0x00, 0x84, 0x15, 0x91, 0x2a, 0xae, 0x3f, 0xbb,
+     0x54, 0xd0, 0x41, 0xc5, 0x7e, 0xfa, 0x6b, 0xef,
+     0x00, 0xa8, 0x4d, 0xe5, 0x9a, 0x32, 0xd7, 0x7f,
+     0x29, 0x81, 0x64, 0xcc, 0xb3, 0x1b, 0xfe, 0x56},
+    {0x00, 0x85, 0x17, 0x92, 0x2e, 0xab, 0x39, 0xbc,
+     0x5c, 0xd9, 0x4b, 0xce, 0x72, 0xf7, 0x65, 0xe0,
+     0x00, 0xb8, 0x6d, 0xd5, 0xda, 0x62, 0xb7, 0x0f,
+     0xa9, 0x11, 0xc4, 0x7c, 0x73, 0xcb, 0x1e, 0xa6},
+    {0x00, 0x86, 0x11, 0x97, 0x22, 0xa4, 0x33, 0xb5,
+     0x44, 0xc2, 0x55, 0xd3, 0x66, 0xe0, 0x77, 0xf1,
+     0x00, 0x88, 0x0d, 0x85, 0x1a, 0x92, 0x17, 0x9f,
+     0x34, 0xbc, 0x39, 0xb1, 0x2e, 0xa6, 0x23, 0xab},
+    {0x00, 0x87, 0x13, 0x94, 0x26, 0xa1, 0x35, 0xb2,
+     0x4c, 0xcb, 0x5f, 0xd8, 0x6a, 0xed, 0x79, 0xfe,
+     0x00, 0x98, 0x2d, 0xb5, 0x5a, 0xc2, 0x77, 0xef,
+     0xb4, 0x2c, 0x99, 0x01, 0xee, 0x76, 0xc3, 0x5b},
+    {0x00, 0x88, 0x0d, 0x85, 0x1a, 0x92, 0x17, 0x9f,
+     0x34, 0xbc, 0x39, 0xb1, 0x2e, 0xa6, 0x23, 0xab,
+     0x00, 0x68, 0xd0, 0xb8, 0xbd, 0xd5, 0x6d, 0x05,
+     0x67, 0x0f, 0xb7, 0xdf, 0xda, 0xb2, 0x0a, 0x62},
+    {0x00, 0x89, 0x0f, 0x86, 0x1e, 0x97, 0x11, 0x98,
+     0x3c, 0xb5, 0x33, 0xba, 0x22, 0xab, 0x2d, 0xa4,
+     0x00, 0x78, 0xf0, 0x88, 0xfd, 0x85, 0x0d, 0x75,
+     0xe7, 0x9f, 0x17, 0x6f, 0x1a, 0x62, 0xea, 0x92},
+    {0x00, 0x8a, 0x09, 0x83, 0x12, 0x98, 0x1b, 0x91,
+     0x24, 0xae, 0x2d, 0xa7, 0x36, 0xbc, 0x3f, 0xb5,
+     0x00, 0x48, 0x90, 0xd8, 0x3d, 0x75, 0xad, 0xe5,
+     0x7a, 0x32, 0xea, 0xa2, 0x47, 0x0f, 0xd7, 0x9f},
+    {0x00, 0x8b, 0x0b, 0x80, 0x16, 0x9d, 0x1d, 0x96,
+     0x2c, 0xa7, 0x27, 0xac, 0x3a, 0xb1, 0x31, 0xba,
+     0x00, 0x58, 0xb0, 0xe8, 0x7d, 0x25, 0xcd, 0x95,
+     0xfa, 0xa2, 0x4a, 0x12, 0x87, 0xdf, 0x37, 0x6f},
+    {0x00, 0x8c, 0x05, 0x89, 0x0a, 0x86, 0x0f, 0x83,
+     0x14, 0x98, 0x11, 0x9d, 0x1e, 0x92, 0x1b, 0x97,
+     0x00, 0x28, 0x50, 0x78, 0xa0, 0x88, 0xf0, 0xd8,
+     0x5d, 0x75, 0x0d, 0x25, 0xfd, 0xd5, 0xad, 0x85},
+    {0x00, 0x8d, 0x07, 0x8a, 0x0e, 0x83, 0x09, 0x84,
+     0x1c, 0x91, 0x1b, 0x96, 0x12, 0x9f, 0x15, 0x98,
+     0x00, 0x38, 0x70, 0x48, 0xe0, 0xd8, 0x90, 0xa8,
+     0xdd, 0xe5, 0xad, 0x95, 0x3d, 0x05, 0x4d, 0x75},
+    {0x00, 0x8e, 0x01, 0x8f, 0x02, 0x8c, 0x03, 0x8d,
+     0x04, 0x8a, 0x05, 0x8b, 0x06, 0x88, 0x07, 0x89,
+     0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38,
+     0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78},
+    {0x00, 0x8f, 0x03, 0x8c, 0x06, 0x89, 0x05, 0x8a,
+     0x0c, 0x83, 0x0f, 0x80, 0x0a, 0x85, 0x09, 0x86,
+     0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48,
+     0xc0, 0xd8, 0xf0, 0xe8, 0xa0, 0xb8, 0x90, 0x88},
+    {0x00, 0x90, 0x3d, 0xad, 0x7a, 0xea, 0x47, 0xd7,
+     0xf4, 0x64, 0xc9, 0x59, 0x8e, 0x1e, 0xb3, 0x23,
+     0x00, 0xf5, 0xf7, 0x02, 0xf3, 0x06, 0x04, 0xf1,
+     0xfb, 0x0e, 0x0c, 0xf9, 0x08, 0xfd, 0xff, 0x0a},
+    {0x00, 0x91, 0x3f, 0xae, 0x7e, 0xef, 0x41, 0xd0,
+     0xfc, 0x6d, 0xc3, 0x52, 0x82, 0x13, 0xbd, 0x2c,
+     0x00, 0xe5, 0xd7, 0x32, 0xb3, 0x56, 0x64, 0x81,
+     0x7b, 0x9e, 0xac, 0x49, 0xc8, 0x2d, 0x1f, 0xfa},
+    {0x00, 0x92, 0x39, 0xab, 0x72, 0xe0, 0x4b, 0xd9,
+     0xe4, 0x76, 0xdd, 0x4f, 0x96, 0x04, 0xaf, 0x3d,
+     0x00, 0xd5, 0xb7, 0x62, 0x73, 0xa6, 0xc4, 0x11,
+     0xe6, 0x33, 0x51, 0x84, 0x95, 0x40, 0x22, 0xf7},
+    {0x00, 0x93, 0x3b, 0xa8, 0x76, 0xe5, 0x4d, 0xde,
+     0xec, 0x7f, 0xd7, 0x44, 0x9a, 0x09, 0xa1, 0x32,
+     0x00, 0xc5, 0x97, 0x52, 0x33, 0xf6, 0xa4, 0x61,
+     0x66, 0xa3, 0xf1, 0x34, 0x55, 0x90, 0xc2, 0x07},
+    {0x00, 0x94, 0x35, 0xa1, 0x6a, 0xfe, 0x5f, 0xcb,
+     0xd4, 0x40, 0xe1, 0x75, 0xbe, 0x2a, 0x8b, 0x1f,
+     0x00, 0xb5, 0x77, 0xc2, 0xee, 0x5b, 0x99, 0x2c,
+     0xc1, 0x74, 0xb6, 0x03, 0x2f, 0x9a, 0x58, 0xed},
+    {0x00, 0x95, 0x37, 0xa2, 0x6e, 0xfb, 0x59, 0xcc,
+     0xdc, 0x49, 0xeb, 0x7e, 0xb2, 0x27, 0x85, 0x10,
+     0x00, 0xa5, 0x57, 0xf2, 0xae, 0x0b, 0xf9, 0x5c,
+     0x41, 0xe4, 0x16, 0xb3, 0xef, 0x4a, 0xb8, 0x1d},
+    {0x00, 0x96, 0x31, 0xa7, 0x62, 0xf4, 0x53, 0xc5,
+     0xc4, 0x52, 0xf5, 0x63, 0xa6, 0x30, 0x97, 0x01,
+     0x00, 0x95, 0x37, 0xa2, 0x6e, 0xfb, 0x59, 0xcc,
+     0xdc, 0x49, 0xeb, 0x7e, 0xb2, 0x27, 0x85, 0x10},
+    {0x00, 0x97, 0x33, 0xa4, 0x66, 0xf1, 0x55, 0xc2,
+     0xcc, 0x5b, 0xff, 0x68, 0xaa, 0x3d, 0x99, 0x0e,
+     0x00, 0x85, 0x17, 0x92, 0x2e, 0xab, 0x39, 0xbc,
+     0x5c, 0xd9, 0x4b, 0xce, 0x72, 0xf7, 0x65, 0xe0},
+    {0x00, 0x98, 0x2d, 0xb5, 0x5a, 0xc2, 0x77, 0xef,
+     0xb4, 0x2c, 0x99, 0x01, 0xee, 0x76, 0xc3, 0x5b,
+     0x00, 0x75, 0xea, 0x9f, 0xc9, 0xbc, 0x23, 0x56,
+     0x8f, 0xfa, 0x65, 0x10, 0x46, 0x33, 0xac, 0xd9},
+    {0x00, 0x99, 0x2f, 0xb6, 0x5e, 0xc7, 0x71, 0xe8,
+     0xbc, 0x25, 0x93, 0x0a, 0xe2, 0x7b, 0xcd, 0x54,
+     0x00, 0x65, 0xca, 0xaf, 0x89, 0xec, 0x43, 0x26,
+     0x0f, 0x6a, 0xc5, 0xa0, 0x86, 0xe3, 0x4c, 0x29},
+    {0x00, 0x9a, 0x29, 0xb3, 0x52, 0xc8, 0x7b, 0xe1,
+     0xa4, 0x3e, 0x8d, 0x17, 0xf6, 0x6c, 0xdf, 0x45,
+     0x00, 0x55, 0xaa, 0xff, 0x49, 0x1c, 0xe3, 0xb6,
+     0x92, 0xc7, 0x38, 0x6d, 0xdb, 0x8e, 0x71, 0x24},
+    {0x00, 0x9b, 0x2b, 0xb0, 0x56, 0xcd, 0x7d, 0xe6,
+     0xac, 0x37, 0x87, 0x1c, 0xfa, 0x61, 0xd1, 0x4a,
+     0x00, 0x45, 0x8a, 0xcf, 0x09, 0x4c, 0x83, 0xc6,
+     0x12, 0x57, 0x98, 0xdd, 0x1b, 0x5e, 0x91, 0xd4},
+    {0x00, 0x9c, 0x25, 0xb9, 0x4a, 0xd6, 0x6f, 0xf3,
+     0x94, 0x08, 0xb1, 0x2d, 0xde, 0x42, 0xfb, 0x67,
+     0x00, 0x35, 0x6a, 0x5f, 0xd4, 0xe1, 0xbe, 0x8b,
+     0xb5, 0x80, 0xdf, 0xea, 0x61, 0x54, 0x0b, 0x3e},
+    {0x00, 0x9d, 0x27, 0xba, 0x4e, 0xd3, 0x69, 0xf4,
+     0x9c, 0x01, 0xbb, 0x26, 0xd2, 0x4f, 0xf5, 0x68,
+     0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb1, 0xde, 0xfb,
+     0x35, 0x10, 0x7f, 0x5a, 0xa1, 0x84, 0xeb, 0xce},
+    {0x00, 0x9e, 0x21, 0xbf, 0x42, 0xdc, 0x63, 0xfd,
+     0x84, 0x1a, 0xa5, 0x3b, 0xc6, 0x58, 0xe7, 0x79,
+     0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b,
+     0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3},
+    {0x00, 0x9f, 0x23, 0xbc, 0x46, 0xd9, 0x65, 0xfa,
+     0x8c, 0x13, 0xaf, 0x30, 0xca, 0x55, 0xe9, 0x76,
+     0x00, 0x05, 0x0a, 0x0f, 0x14, 0x11, 0x1e, 0x1b,
+     0x28, 0x2d, 0x22, 0x27, 0x3c, 0x39, 0x36, 0x33},
+    {0x00, 0xa0, 0x5d, 0xfd, 0xba, 0x1a, 0xe7, 0x47,
+     0x69, 0xc9, 0x34, 0x94, 0xd3, 0x73, 0x8e, 0x2e,
+     0x00, 0xd2, 0xb9, 0x6b, 0x6f, 0xbd, 0xd6, 0x04,
+     0xde, 0x0c, 0x67, 0xb5, 0xb1, 0x63, 0x08, 0xda},
+    {0x00, 0xa1, 0x5f, 0xfe, 0xbe, 0x1f, 0xe1, 0x40,
+     0x61, 0xc0, 0x3e, 0x9f, 0xdf, 0x7e, 0x80, 0x21,
+     0x00, 0xc2, 0x99, 0x5b, 0x2f, 0xed, 0xb6, 0x74,
+     0x5e, 0x9c, 0xc7, 0x05, 0x71, 0xb3, 0xe8, 0x2a},
+    {0x00, 0xa2, 0x59, 0xfb, 0xb2, 0x10, 0xeb, 0x49,
+     0x79, 0xdb, 0x20, 0x82, 0xcb, 0x69, 0x92, 0x30,
+     0x00, 0xf2, 0xf9, 0x0b, 0xef, 0x1d, 0x16, 0xe4,
+     0xc3, 0x31, 0x3a, 0xc8, 0x2c, 0xde, 0xd5, 0x27},
+    {0x00, 0xa3, 0x5b, 0xf8, 0xb6, 0x15, 0xed, 0x4e,
+     0x71, 0xd2, 0x2a, 0x89, 0xc7, 0x64, 0x9c, 0x3f,
+     0x00, 0xe2, 0xd9, 0x3b, 0xaf, 0x4d, 0x76, 0x94,
+     0x43, 0xa1, 0x9a, 0x78, 0xec, 0x0e, 0x35, 0xd7},
+    {0x00, 0xa4, 0x55, 0xf1, 0xaa, 0x0e, 0xff, 0x5b,
+     0x49, 0xed, 0x1c, 0xb8, 0xe3, 0x47, 0xb6, 0x12,
+     0x00, 0x92, 0x39, 0xab, 0x72, 0xe0, 0x4b, 0xd9,
+     0xe4, 0x76, 0xdd, 0x4f, 0x96, 0x04, 0xaf, 0x3d},
+    {0x00, 0xa5, 0x57, 0xf2, 0xae, 0x0b, 0xf9, 0x5c,
+     0x41, 0xe4, 0x16, 0xb3, 0xef, 0x4a, 0xb8, 0x1d,
+     0x00, 0x82, 0x19, 0x9b, 0x32, 0xb0, 0x2b, 0xa9,
+     0x64, 0xe6, 0x7d, 0xff, 0x56, 0xd4, 0x4f, 0xcd},
+    {0x00, 0xa6, 0x51, 0xf7, 0xa2, 0x04, 0xf3, 0x55,
+     0x59, 0xff, 0x08, 0xae, 0xfb, 0x5d, 0xaa, 0x0c,
+     0x00, 0xb2, 0x79, 0xcb, 0xf2, 0x40, 0x8b, 0x39,
+     0xf9, 0x4b, 0x80, 0x32, 0x0b, 0xb9, 0x72, 0xc0},
+    {0x00, 0xa7, 0x53, 0xf4, 0xa6, 0x01, 0xf5, 0x52,
+     0x51, 0xf6, 0x02, 0xa5, 0xf7, 0x50, 0xa4, 0x03,
+     0x00, 0xa2, 0x59, 0xfb, 0xb2, 0x10, 0xeb, 0x49,
+     0x79, 0xdb, 0x20, 0x82, 0xcb, 0x69, 0x92, 0x30},
+    {0x00, 0xa8, 0x4d, 0xe5, 0x9a, 0x32, 0xd7, 0x7f,
+     0x29, 0x81, 0x64, 0xcc, 0xb3, 0x1b, 0xfe, 0x56,
+     0x00, 0x52, 0xa4, 0xf6, 0x55, 0x07, 0xf1, 0xa3,
+     0xaa, 0xf8, 0x0e, 0x5c, 0xff, 0xad, 0x5b, 0x09},
+    {0x00, 0xa9, 0x4f, 0xe6, 0x9e, 0x37, 0xd1, 0x78,
+     0x21, 0x88, 0x6e, 0xc7, 0xbf, 0x16, 0xf0, 0x59,
+     0x00, 0x42, 0x84, 0xc6, 0x15, 0x57, 0x91, 0xd3,
+     0x2a, 0x68, 0xae, 0xec, 0x3f, 0x7d, 0xbb, 0xf9},
+    {0x00, 0xaa, 0x49, 0xe3, 0x92, 0x38, 0xdb, 0x71,
+     0x39, 0x93, 0x70, 0xda, 0xab, 0x01, 0xe2, 0x48,
+     0x00, 0x72, 0xe4, 0x96, 0xd5, 0xa7, 0x31, 0x43,
+     0xb7, 0xc5, 0x53, 0x21, 0x62, 0x10, 0x86, 0xf4},
+    {0x00, 0xab, 0x4b, 0xe0, 0x96, 0x3d, 0xdd, 0x76,
+     0x31, 0x9a, 0x7a, 0xd1, 0xa7, 0x0c, 0xec, 0x47,
+     0x00, 0x62, 0xc4, 0xa6, 0x95, 0xf7, 0x51, 0x33,
+     0x37, 0x55, 0xf3, 0x91, 0xa2, 0xc0, 0x66, 0x04},
+    {0x00, 0xac, 0x45, 0xe9, 0x8a, 0x26, 0xcf, 0x63,
+     0x09, 0xa5, 0x4c, 0xe0, 0x83, 0x2f, 0xc6, 0x6a,
+     0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e,
+     0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee},
+    {0x00, 0xad, 0x47, 0xea, 0x8e, 0x23, 0xc9, 0x64,
+     0x01, 0xac, 0x46, 0xeb, 0x8f, 0x22, 0xc8, 0x65,
+     0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e,
+     0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e},
+    {0x00, 0xae, 0x41, 0xef, 0x82, 0x2c, 0xc3, 0x6d,
+     0x19, 0xb7, 0x58, 0xf6, 0x9b, 0x35, 0xda, 0x74,
+     0x00, 0x32, 0x64, 0x56, 0xc8, 0xfa, 0xac, 0x9e,
+     0x8d, 0xbf, 0xe9, 0xdb, 0x45, 0x77, 0x21, 0x13},
+    {0x00, 0xaf, 0x43, 0xec, 0x86, 0x29, 0xc5, 0x6a,
+     0x11, 0xbe, 0x52, 0xfd, 0x97, 0x38, 0xd4, 0x7b,
+     0x00, 0x22, 0x44, 0x66, 0x88, 0xaa, 0xcc, 0xee,
+     0x0d, 0x2f, 0x49, 0x6b, 0x85, 0xa7, 0xc1, 0xe3},
+    {0x00, 0xb0, 0x7d, 0xcd, 0xfa, 0x4a, 0x87, 0x37,
+     0xe9, 0x59, 0x94, 0x24, 0x13, 0xa3, 0x6e, 0xde,
+     0x00, 0xcf, 0x83, 0x4c, 0x1b, 0xd4, 0x98, 0x57,
+     0x36, 0xf9, 0xb5, 0x7a, 0x2d, 0xe2, 0xae, 0x61},
+    {0x00, 0xb1, 0x7f, 0xce, 0xfe, 0x4f, 0x81, 0x30,
+     0xe1, 0x50, 0x9e, 0x2f, 0x1f, 0xae, 0x60, 0xd1,
+     0x00, 0xdf, 0xa3, 0x7c, 0x5b, 0x84, 0xf8, 0x27,
+     0xb6, 0x69, 0x15, 0xca, 0xed, 0x32, 0x4e, 0x91},
+    {0x00, 0xb2, 0x79, 0xcb, 0xf2, 0x40, 0x8b, 0x39,
+     0xf9, 0x4b, 0x80, 0x32, 0x0b, 0xb9, 0x72, 0xc0,
+     0x00, 0xef, 0xc3, 0x2c, 0x9b, 0x74, 0x58, 0xb7,
+     0x2b, 0xc4, 0xe8, 0x07, 0xb0, 0x5f, 0x73, 0x9c},
+    {0x00, 0xb3, 0x7b, 0xc8, 0xf6, 0x45, 0x8d, 0x3e,
+     0xf1, 0x42, 0x8a, 0x39, 0x07, 0xb4, 0x7c, 0xcf,
+     0x00, 0xff, 0xe3, 0x1c, 0xdb, 0x24, 0x38, 0xc7,
+     0xab, 0x54, 0x48, 0xb7, 0x70, 0x8f, 0x93, 0x6c},
+    {0x00, 0xb4, 0x75, 0xc1, 0xea, 0x5e, 0x9f, 0x2b,
+     0xc9, 0x7d, 0xbc, 0x08, 0x23, 0x97, 0x56, 0xe2,
+     0x00, 0x8f, 0x03, 0x8c, 0x06, 0x89, 0x05, 0x8a,
+     0x0c, 0x83, 0x0f, 0x80, 0x0a, 0x85, 0x09, 0x86},
+    {0x00, 0xb5, 0x77, 0xc2, 0xee, 0x5b, 0x99, 0x2c,
+     0xc1, 0x74, 0xb6, 0x03, 0x2f, 0x9a, 0x58, 0xed,
+     0x00, 0x9f, 0x23, 0xbc, 0x46, 0xd9, 0x65, 0xfa,
+     0x8c, 0x13, 0xaf, 0x30, 0xca, 0x55, 0xe9, 0x76},
+    {0x00, 0xb6, 0x71, 0xc7, 0xe2, 0x54, 0x93, 0x25,
+     0xd9, 0x6f, 0xa8, 0x1e, 0x3b, 0x8d, 0x4a, 0xfc,
+     0x00, 0xaf, 0x43, 0xec, 0x86, 0x29, 0xc5, 0x6a,
+     0x11, 0xbe, 0x52, 0xfd, 0x97, 0x38, 0xd4, 0x7b},
+    {0x00, 0xb7, 0x73, 0xc4, 0xe6, 0x51, 0x95, 0x22,
+     0xd1, 0x66, 0xa2, 0x15, 0x37, 0x80, 0x44, 0xf3,
+     0x00, 0xbf, 0x63, 0xdc, 0xc6, 0x79, 0xa5, 0x1a,
+     0x91, 0x2e, 0xf2, 0x4d, 0x57, 0xe8, 0x34, 0x8b},
+    {0x00, 0xb8, 0x6d, 0xd5, 0xda, 0x62, 0xb7, 0x0f,
+     0xa9, 0x11, 0xc4, 0x7c, 0x73, 0xcb, 0x1e, 0xa6,
+     0x00, 0x4f, 0x9e, 0xd1, 0x21, 0x6e, 0xbf, 0xf0,
+     0x42, 0x0d, 0xdc, 0x93, 0x63, 0x2c, 0xfd, 0xb2},
+    {0x00, 0xb9, 0x6f, 0xd6, 0xde, 0x67, 0xb1, 0x08,
+     0xa1, 0x18, 0xce, 0x77, 0x7f, 0xc6, 0x10, 0xa9,
+     0x00, 0x5f, 0xbe, 0xe1, 0x61, 0x3e, 0xdf, 0x80,
+     0xc2, 0x9d, 0x7c, 0x23, 0xa3, 0xfc, 0x1d, 0x42},
+    {0x00, 0xba, 0x69, 0xd3, 0xd2, 0x68, 0xbb, 0x01,
+     0xb9, 0x03, 0xd0, 0x6a, 0x6b, 0xd1, 0x02, 0xb8,
+     0x00, 0x6f, 0xde, 0xb1, 0xa1, 0xce, 0x7f, 0x10,
+     0x5f, 0x30, 0x81, 0xee, 0xfe, 0x91, 0x20, 0x4f},
+    {0x00, 0xbb, 0x6b, 0xd0, 0xd6, 0x6d, 0xbd, 0x06,
+     0xb1, 0x0a, 0xda, 0x61, 0x67, 0xdc, 0x0c, 0xb7,
+     0x00, 0x7f, 0xfe, 0x81, 0xe1, 0x9e, 0x1f, 0x60,
+     0xdf, 0xa0, 0x21, 0x5e, 0x3e, 0x41, 0xc0, 0xbf},
+    {0x00, 0xbc, 0x65, 0xd9, 0xca, 0x76, 0xaf, 0x13,
+     0x89, 0x35, 0xec, 0x50, 0x43, 0xff, 0x26, 0x9a,
+     0x00, 0x0f, 0x1e, 0x11, 0x3c, 0x33, 0x22, 0x2d,
+     0x78, 0x77, 0x66, 0x69, 0x44, 0x4b, 0x5a, 0x55},
+    {0x00, 0xbd, 0x67, 0xda, 0xce, 0x73, 0xa9, 0x14,
+     0x81, 0x3c, 0xe6, 0x5b, 0x4f, 0xf2, 0x28, 0x95,
+     0x00, 0x1f, 0x3e, 0x21, 0x7c, 0x63, 0x42, 0x5d,
+     0xf8, 0xe7, 0xc6, 0xd9, 0x84, 0x9b, 0xba, 0xa5},
+    {0x00, 0xbe, 0x61, 0xdf, 0xc2, 0x7c, 0xa3, 0x1d,
+     0x99, 0x27, 0xf8, 0x46, 0x5b, 0xe5, 0x3a, 0x84,
+     0x00, 0x2f, 0x5e, 0x71, 0xbc, 0x93, 0xe2, 0xcd,
+     0x65, 0x4a, 0x3b, 0x14, 0xd9, 0xf6, 0x87, 0xa8},
+    {0x00, 0xbf, 0x63, 0xdc, 0xc6, 0x79, 0xa5, 0x1a,
+     0x91, 0x2e, 0xf2, 0x4d, 0x57, 0xe8, 0x34, 0x8b,
+     0x00, 0x3f, 0x7e, 0x41, 0xfc, 0xc3, 0x82, 0xbd,
+     0xe5, 0xda, 0x9b, 0xa4, 0x19, 0x26, 0x67, 0x58},
+    {0x00, 0xc0, 0x9d, 0x5d, 0x27, 0xe7, 0xba, 0x7a,
+     0x4e, 0x8e, 0xd3, 0x13, 0x69, 0xa9, 0xf4, 0x34,
+     0x00, 0x9c, 0x25, 0xb9, 0x4a, 0xd6, 0x6f, 0xf3,
+     0x94, 0x08, 0xb1, 0x2d, 0xde, 0x42, 0xfb, 0x67},
+    {0x00, 0xc1, 0x9f, 0x5e, 0x23, 0xe2, 0xbc, 0x7d,
+     0x46, 0x87, 0xd9, 0x18, 0x65, 0xa4, 0xfa, 0x3b,
+     0x00, 0x8c, 0x05, 0x89, 0x0a, 0x86, 0x0f, 0x83,
+     0x14, 0x98, 0x11, 0x9d, 0x1e, 0x92, 0x1b, 0x97},
+    {0x00, 0xc2, 0x99, 0x5b, 0x2f, 0xed, 0xb6, 0x74,
+     0x5e, 0x9c, 0xc7, 0x05, 0x71, 0xb3, 0xe8, 0x2a,
+     0x00, 0xbc, 0x65, 0xd9, 0xca, 0x76, 0xaf, 0x13,
+     0x89, 0x35, 0xec, 0x50, 0x43, 0xff, 0x26, 0x9a},
+    {0x00, 0xc3, 0x9b, 0x58, 0x2b, 0xe8, 0xb0, 0x73,
+     0x56, 0x95, 0xcd, 0x0e, 0x7d, 0xbe, 0xe6, 0x25,
+     0x00, 0xac, 0x45, 0xe9, 0x8a, 0x26, 0xcf, 0x63,
+     0x09, 0xa5, 0x4c, 0xe0, 0x83, 0x2f, 0xc6, 0x6a},
+    {0x00, 0xc4, 0x95, 0x51, 0x37, 0xf3, 0xa2, 0x66,
+     0x6e, 0xaa, 0xfb, 0x3f, 0x59, 0x9d, 0xcc, 0x08,
+     0x00, 0xdc, 0xa5, 0x79, 0x57, 0x8b, 0xf2, 0x2e,
+     0xae, 0x72, 0x0b, 0xd7, 0xf9, 0x25, 0x5c, 0x80},
+    {0x00, 0xc5, 0x97, 0x52, 0x33, 0xf6, 0xa4, 0x61,
+     0x66, 0xa3, 0xf1, 0x34, 0x55, 0x90, 0xc2, 0x07,
+     0x00, 0xcc, 0x85, 0x49, 0x17, 0xdb, 0x92, 0x5e,
+     0x2e, 0xe2, 0xab, 0x67, 0x39, 0xf5, 0xbc, 0x70},
+    {0x00, 0xc6, 0x91, 0x57, 0x3f, 0xf9, 0xae, 0x68,
+     0x7e, 0xb8, 0xef, 0x29, 0x41, 0x87, 0xd0, 0x16,
+     0x00, 0xfc, 0xe5, 0x19, 0xd7, 0x2b, 0x32, 0xce,
+     0xb3, 0x4f, 0x56, 0xaa, 0x64, 0x98, 0x81, 0x7d},
+    {0x00, 0xc7, 0x93, 0x54, 0x3b, 0xfc, 0xa8, 0x6f,
+     0x76, 0xb1, 0xe5, 0x22, 0x4d, 0x8a, 0xde, 0x19,
+     0x00, 0xec, 0xc5, 0x29, 0x97, 0x7b, 0x52, 0xbe,
+     0x33, 0xdf, 0xf6, 0x1a, 0xa4, 0x48, 0x61, 0x8d},
+    {0x00, 0xc8, 0x8d, 0x45, 0x07, 0xcf, 0x8a, 0x42,
+     0x0e, 0xc6, 0x83, 0x4b, 0x09, 0xc1, 0x84, 0x4c,
+     0x00, 0x1c, 0x38, 0x24, 0x70, 0x6c, 0x48, 0x54,
+     0xe0, 0xfc, 0xd8, 0xc4, 0x90, 0x8c, 0xa8, 0xb4},
+    {0x00, 0xc9, 0x8f, 0x46, 0x03, 0xca, 0x8c, 0x45,
+     0x06, 0xcf, 0x89, 0x40, 0x05, 0xcc, 0x8a, 0x43,
+     0x00, 0x0c, 0x18, 0x14, 0x30, 0x3c, 0x28, 0x24,
+     0x60, 0x6c, 0x78, 0x74, 0x50, 0x5c, 0x48, 0x44},
+    {0x00, 0xca, 0x89, 0x43, 0x0f, 0xc5, 0x86, 0x4c,
+     0x1e, 0xd4, 0x97, 0x5d, 0x11, 0xdb, 0x98, 0x52,
+     0x00, 0x3c, 0x78, 0x44, 0xf0, 0xcc, 0x88, 0xb4,
+     0xfd, 0xc1, 0x85, 0xb9, 0x0d, 0x31, 0x75, 0x49},
+    {0x00, 0xcb, 0x8b, 0x40, 0x0b, 0xc0, 0x80, 0x4b,
+     0x16, 0xdd, 0x9d, 0x56, 0x1d, 0xd6, 0x96, 0x5d,
+     0x00, 0x2c, 0x58, 0x74, 0xb0, 0x9c, 0xe8, 0xc4,
+     0x7d, 0x51, 0x25, 0x09, 0xcd, 0xe1, 0x95, 0xb9},
+    {0x00, 0xcc, 0x85, 0x49, 0x17, 0xdb, 0x92, 0x5e,
+     0x2e, 0xe2, 0xab, 0x67, 0x39, 0xf5, 0xbc, 0x70,
+     0x00, 0x5c, 0xb8, 0xe4, 0x6d, 0x31, 0xd5, 0x89,
+     0xda, 0x86, 0x62, 0x3e, 0xb7, 0xeb, 0x0f, 0x53},
+    {0x00, 0xcd, 0x87, 0x4a, 0x13, 0xde, 0x94, 0x59,
+     0x26, 0xeb, 0xa1, 0x6c, 0x35, 0xf8, 0xb2, 0x7f,
+     0x00, 0x4c, 0x98, 0xd4, 0x2d, 0x61, 0xb5, 0xf9,
+     0x5a, 0x16, 0xc2, 0x8e, 0x77, 0x3b, 0xef, 0xa3},
+    {0x00, 0xce, 0x81, 0x4f, 0x1f, 0xd1, 0x9e, 0x50,
+     0x3e, 0xf0, 0xbf, 0x71, 0x21, 0xef, 0xa0, 0x6e,
+     0x00, 0x7c, 0xf8, 0x84, 0xed, 0x91, 0x15, 0x69,
+     0xc7, 0xbb, 0x3f, 0x43, 0x2a, 0x56, 0xd2, 0xae},
+    {0x00, 0xcf, 0x83, 0x4c, 0x1b, 0xd4, 0x98, 0x57,
+     0x36, 0xf9, 0xb5, 0x7a, 0x2d, 0xe2, 0xae, 0x61,
+     0x00, 0x6c, 0xd8, 0xb4, 0xad, 0xc1, 0x75, 0x19,
+     0x47, 0x2b, 0x9f, 0xf3, 0xea, 0x86, 0x32, 0x5e},
+    {0x00, 0xd0, 0xbd, 0x6d, 0x67, 0xb7, 0xda, 0x0a,
+     0xce, 0x1e, 0x73, 0xa3, 0xa9, 0x79, 0x14, 0xc4,
+     0x00, 0x81, 0x1f, 0x9e, 0x3e, 0xbf, 0x21, 0xa0,
+     0x7c, 0xfd, 0x63, 0xe2, 0x42, 0xc3, 0x5d, 0xdc},
+    {0x00, 0xd1, 0xbf, 0x6e, 0x63, 0xb2, 0xdc, 0x0d,
+     0xc6, 0x17, 0x79, 0xa8, 0xa5, 0x74, 0x1a, 0xcb,
+     0x00, 0x91, 0x3f, 0xae, 0x7e, 0xef, 0x41, 0xd0,
+     0xfc, 0x6d, 0xc3, 0x52, 0x82, 0x13, 0xbd, 0x2c},
+    {0x00, 0xd2, 0xb9, 0x6b, 0x6f, 0xbd, 0xd6, 0x04,
+     0xde, 0x0c, 0x67, 0xb5, 0xb1, 0x63, 0x08, 0xda,
+     0x00, 0xa1, 0x5f, 0xfe, 0xbe, 0x1f, 0xe1, 0x40,
+     0x61, 0xc0, 0x3e, 0x9f, 0xdf, 0x7e, 0x80, 0x21},
+    {0x00, 0xd3, 0xbb, 0x68, 0x6b, 0xb8, 0xd0, 0x03,
+     0xd6, 0x05, 0x6d, 0xbe, 0xbd, 0x6e, 0x06, 0xd5,
+     0x00, 0xb1, 0x7f, 0xce, 0xfe, 0x4f, 0x81, 0x30,
+     0xe1, 0x50, 0x9e, 0x2f, 0x1f, 0xae, 0x60, 0xd1},
+    {0x00, 0xd4, 0xb5, 0x61, 0x77, 0xa3, 0xc2, 0x16,
+     0xee, 0x3a, 0x5b, 0x8f, 0x99, 0x4d, 0x2c, 0xf8,
+     0x00, 0xc1, 0x9f, 0x5e, 0x23, 0xe2, 0xbc, 0x7d,
+     0x46, 0x87, 0xd9, 0x18, 0x65, 0xa4, 0xfa, 0x3b},
+    {0x00, 0xd5, 0xb7, 0x62, 0x73, 0xa6, 0xc4, 0x11,
+     0xe6, 0x33, 0x51, 0x84, 0x95, 0x40, 0x22, 0xf7,
+     0x00, 0xd1, 0xbf, 0x6e, 0x63, 0xb2, 0xdc, 0x0d,
+     0xc6, 0x17, 0x79, 0xa8, 0xa5, 0x74, 0x1a, 0xcb},
+    {0x00, 0xd6, 0xb1, 0x67, 0x7f, 0xa9, 0xce, 0x18,
+     0xfe, 0x28, 0x4f, 0x99, 0x81, 0x57, 0x30, 0xe6,
+     0x00, 0xe1, 0xdf, 0x3e, 0xa3, 0x42, 0x7c, 0x9d,
+     0x5b, 0xba, 0x84, 0x65, 0xf8, 0x19, 0x27, 0xc6},
+    {0x00, 0xd7, 0xb3, 0x64, 0x7b, 0xac, 0xc8, 0x1f,
+     0xf6, 0x21, 0x45, 0x92, 0x8d, 0x5a, 0x3e, 0xe9,
+     0x00, 0xf1, 0xff, 0x0e, 0xe3, 0x12, 0x1c, 0xed,
+     0xdb, 0x2a, 0x24, 0xd5, 0x38, 0xc9, 0xc7, 0x36},
+    {0x00, 0xd8, 0xad, 0x75, 0x47, 0x9f, 0xea, 0x32,
+     0x8e, 0x56, 0x23, 0xfb, 0xc9, 0x11, 0x64, 0xbc,
+     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+     0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+    {0x00, 0xd9, 0xaf, 0x76, 0x43, 0x9a, 0xec, 0x35,
+     0x86, 0x5f, 0x29, 0xf0, 0xc5, 0x1c, 0x6a, 0xb3,
+     0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+     0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff},
+    {0x00, 0xda, 0xa9, 0x73, 0x4f, 0x95, 0xe6, 0x3c,
+     0x9e, 0x44, 0x37, 0xed, 0xd1, 0x0b, 0x78, 0xa2,
+     0x00, 0x21, 0x42, 0x63, 0x84, 0xa5, 0xc6, 0xe7,
+     0x15, 0x34, 0x57, 0x76, 0x91, 0xb0, 0xd3, 0xf2},
+    {0x00, 0xdb, 0xab, 0x70, 0x4b, 0x90, 0xe0, 0x3b,
+     0x96, 0x4d, 0x3d, 0xe6, 0xdd, 0x06, 0x76, 0xad,
+     0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97,
+     0x95, 0xa4, 0xf7, 0xc6, 0x51, 0x60, 0x33, 0x02},
+    {0x00, 0xdc, 0xa5, 0x79, 0x57, 0x8b, 0xf2, 0x2e,
+     0xae, 0x72, 0x0b, 0xd7, 0xf9, 0x25, 0x5c, 0x80,
+     0x00, 0x41, 0x82, 0xc3, 0x19, 0x58, 0x9b, 0xda,
+     0x32, 0x73, 0xb0, 0xf1, 0x2b, 0x6a, 0xa9, 0xe8},
+    {0x00, 0xdd, 0xa7, 0x7a, 0x53, 0x8e, 0xf4, 0x29,
+     0xa6, 0x7b, 0x01, 0xdc, 0xf5, 0x28, 0x52, 0x8f,
+     0x00, 0x51, 0xa2, 0xf3, 0x59, 0x08, 0xfb, 0xaa,
+     0xb2, 0xe3, 0x10, 0x41, 0xeb, 0xba, 0x49, 0x18},
+    {0x00, 0xde, 0xa1, 0x7f, 0x5f, 0x81, 0xfe, 0x20,
+     0xbe, 0x60, 0x1f, 0xc1, 0xe1, 0x3f, 0x40, 0x9e,
+     0x00, 0x61, 0xc2, 0xa3, 0x99, 0xf8, 0x5b, 0x3a,
+     0x2f, 0x4e, 0xed, 0x8c, 0xb6, 0xd7, 0x74, 0x15},
+    {0x00, 0xdf, 0xa3, 0x7c, 0x5b, 0x84, 0xf8, 0x27,
+     0xb6, 0x69, 0x15, 0xca, 0xed, 0x32, 0x4e, 0x91,
+     0x00, 0x71, 0xe2, 0x93, 0xd9, 0xa8, 0x3b, 0x4a,
+     0xaf, 0xde, 0x4d, 0x3c, 0x76, 0x07, 0x94, 0xe5},
+    {0x00, 0xe0, 0xdd, 0x3d, 0xa7, 0x47, 0x7a, 0x9a,
+     0x53, 0xb3, 0x8e, 0x6e, 0xf4, 0x14, 0x29, 0xc9,
+     0x00, 0xa6, 0x51, 0xf7, 0xa2, 0x04, 0xf3, 0x55,
+     0x59, 0xff, 0x08, 0xae, 0xfb, 0x5d, 0xaa, 0x0c},
+    {0x00, 0xe1, 0xdf, 0x3e, 0xa3, 0x42, 0x7c, 0x9d,
+     0x5b, 0xba, 0x84, 0x65, 0xf8, 0x19, 0x27, 0xc6,
+     0x00, 0xb6, 0x71, 0xc7, 0xe2, 0x54, 0x93, 0x25,
+     0xd9, 0x6f, 0xa8, 0x1e, 0x3b, 0x8d, 0x4a, 0xfc},
+    {0x00, 0xe2, 0xd9, 0x3b, 0xaf, 0x4d, 0x76, 0x94,
+     0x43, 0xa1, 0x9a, 0x78, 0xec, 0x0e, 0x35, 0xd7,
+     0x00, 0x86, 0x11, 0x97, 0x22, 0xa4, 0x33, 0xb5,
+     0x44, 0xc2, 0x55, 0xd3, 0x66, 0xe0, 0x77, 0xf1},
+    {0x00, 0xe3, 0xdb, 0x38, 0xab, 0x48, 0x70, 0x93,
+     0x4b, 0xa8, 0x90, 0x73, 0xe0, 0x03, 0x3b, 0xd8,
+     0x00, 0x96, 0x31, 0xa7, 0x62, 0xf4, 0x53, 0xc5,
+     0xc4, 0x52, 0xf5, 0x63, 0xa6, 0x30, 0x97, 0x01},
+    {0x00, 0xe4, 0xd5, 0x31, 0xb7, 0x53, 0x62, 0x86,
+     0x73, 0x97, 0xa6, 0x42, 0xc4, 0x20, 0x11, 0xf5,
+     0x00, 0xe6, 0xd1, 0x37, 0xbf, 0x59, 0x6e, 0x88,
+     0x63, 0x85, 0xb2, 0x54, 0xdc, 0x3a, 0x0d, 0xeb},
+    {0x00, 0xe5, 0xd7, 0x32, 0xb3, 0x56, 0x64, 0x81,
+     0x7b, 0x9e, 0xac, 0x49, 0xc8, 0x2d, 0x1f, 0xfa,
+     0x00, 0xf6, 0xf1, 0x07, 0xff, 0x09, 0x0e, 0xf8,
+     0xe3, 0x15, 0x12, 0xe4, 0x1c, 0xea, 0xed, 0x1b},
+    {0x00, 0xe6, 0xd1, 0x37, 0xbf, 0x59, 0x6e, 0x88,
+     0x63, 0x85, 0xb2, 0x54, 0xdc, 0x3a, 0x0d, 0xeb,
+     0x00, 0xc6, 0x91, 0x57, 0x3f, 0xf9, 0xae, 0x68,
+     0x7e, 0xb8, 0xef, 0x29, 0x41, 0x87, 0xd0, 0x16},
+    {0x00, 0xe7, 0xd3, 0x34, 0xbb, 0x5c, 0x68, 0x8f,
+     0x6b, 0x8c, 0xb8, 0x5f, 0xd0, 0x37, 0x03, 0xe4,
+     0x00, 0xd6, 0xb1, 0x67, 0x7f, 0xa9, 0xce, 0x18,
+     0xfe, 0x28, 0x4f, 0x99, 0x81, 0x57, 0x30, 0xe6},
+    {0x00, 0xe8, 0xcd, 0x25, 0x87, 0x6f, 0x4a, 0xa2,
+     0x13, 0xfb, 0xde, 0x36, 0x94, 0x7c, 0x59, 0xb1,
+     0x00, 0x26, 0x4c, 0x6a, 0x98, 0xbe, 0xd4, 0xf2,
+     0x2d, 0x0b, 0x61, 0x47, 0xb5, 0x93, 0xf9, 0xdf},
+    {0x00, 0xe9, 0xcf, 0x26, 0x83, 0x6a, 0x4c, 0xa5,
+     0x1b, 0xf2, 0xd4, 0x3d, 0x98, 0x71, 0x57, 0xbe,
+     0x00, 0x36, 0x6c, 0x5a, 0xd8, 0xee, 0xb4, 0x82,
+     0xad, 0x9b, 0xc1, 0xf7, 0x75, 0x43, 0x19, 0x2f},
+    {0x00, 0xea, 0xc9, 0x23, 0x8f, 0x65, 0x46, 0xac,
+     0x03, 0xe9, 0xca, 0x20, 0x8c, 0x66, 0x45, 0xaf,
+     0x00, 0x06, 0x0c, 0x0a, 0x18, 0x1e, 0x14, 0x12,
+     0x30, 0x36, 0x3c, 0x3a, 0x28, 0x2e, 0x24, 0x22},
+    {0x00, 0xeb, 0xcb, 0x20, 0x8b, 0x60, 0x40, 0xab,
+     0x0b, 0xe0, 0xc0, 0x2b, 0x80, 0x6b, 0x4b, 0xa0,
+     0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62,
+     0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2},
+    {0x00, 0xec, 0xc5, 0x29, 0x97, 0x7b, 0x52, 0xbe,
+     0x33, 0xdf, 0xf6, 0x1a, 0xa4, 0x48, 0x61, 0x8d,
+     0x00, 0x66, 0xcc, 0xaa, 0x85, 0xe3, 0x49, 0x2f,
+     0x17, 0x71, 0xdb, 0xbd, 0x92, 0xf4, 0x5e, 0x38},
+    {0x00, 0xed, 0xc7, 0x2a, 0x93, 0x7e, 0x54, 0xb9,
+     0x3b, 0xd6, 0xfc, 0x11, 0xa8, 0x45, 0x6f, 0x82,
+     0x00, 0x76, 0xec, 0x9a, 0xc5, 0xb3, 0x29, 0x5f,
+     0x97, 0xe1, 0x7b, 0x0d, 0x52, 0x24, 0xbe, 0xc8},
+    {0x00, 0xee, 0xc1, 0x2f, 0x9f, 0x71, 0x5e, 0xb0,
+     0x23, 0xcd, 0xe2, 0x0c, 0xbc, 0x52, 0x7d, 0x93,
+     0x00, 0x46, 0x8c, 0xca, 0x05, 0x43, 0x89, 0xcf,
+     0x0a, 0x4c, 0x86, 0xc0, 0x0f, 0x49, 0x83, 0xc5},
+    {0x00, 0xef, 0xc3, 0x2c, 0x9b, 0x74, 0x58, 0xb7,
+     0x2b, 0xc4, 0xe8, 0x07, 0xb0, 0x5f, 0x73, 0x9c,
+     0x00, 0x56, 0xac, 0xfa, 0x45, 0x13, 0xe9, 0xbf,
+     0x8a, 0xdc, 0x26, 0x70, 0xcf, 0x99, 0x63, 0x35},
+    {0x00, 0xf0, 0xfd, 0x0d, 0xe7, 0x17, 0x1a, 0xea,
+     0xd3, 0x23, 0x2e, 0xde, 0x34, 0xc4, 0xc9, 0x39,
+     0x00, 0xbb, 0x6b, 0xd0, 0xd6, 0x6d, 0xbd, 0x06,
+     0xb1, 0x0a, 0xda, 0x61, 0x67, 0xdc, 0x0c, 0xb7},
+    {0x00, 0xf1, 0xff, 0x0e, 0xe3, 0x12, 0x1c, 0xed,
+     0xdb, 0x2a, 0x24, 0xd5, 0x38, 0xc9, 0xc7, 0x36,
+     0x00, 0xab, 0x4b, 0xe0, 0x96, 0x3d, 0xdd, 0x76,
+     0x31, 0x9a, 0x7a, 0xd1, 0xa7, 0x0c, 0xec, 0x47},
+    {0x00, 0xf2, 0xf9, 0x0b, 0xef, 0x1d, 0x16, 0xe4,
+     0xc3, 0x31, 0x3a, 0xc8, 0x2c, 0xde, 0xd5, 0x27,
+     0x00, 0x9b, 0x2b, 0xb0, 0x56, 0xcd, 0x7d, 0xe6,
+     0xac, 0x37, 0x87, 0x1c, 0xfa, 0x61, 0xd1, 0x4a},
+    {0x00, 0xf3, 0xfb, 0x08, 0xeb, 0x18, 0x10, 0xe3,
+     0xcb, 0x38, 0x30, 0xc3, 0x20, 0xd3, 0xdb, 0x28,
+     0x00, 0x8b, 0x0b, 0x80, 0x16, 0x9d, 0x1d, 0x96,
+     0x2c, 0xa7, 0x27, 0xac, 0x3a, 0xb1, 0x31, 0xba},
+    {0x00, 0xf4, 0xf5, 0x01, 0xf7, 0x03, 0x02, 0xf6,
+     0xf3, 0x07, 0x06, 0xf2, 0x04, 0xf0, 0xf1, 0x05,
+     0x00, 0xfb, 0xeb, 0x10, 0xcb, 0x30, 0x20, 0xdb,
+     0x8b, 0x70, 0x60, 0x9b, 0x40, 0xbb, 0xab, 0x50},
+    {0x00, 0xf5, 0xf7, 0x02, 0xf3, 0x06, 0x04, 0xf1,
+     0xfb, 0x0e, 0x0c, 0xf9, 0x08, 0xfd, 0xff, 0x0a,
+     0x00, 0xeb, 0xcb, 0x20, 0x8b, 0x60, 0x40, 0xab,
+     0x0b, 0xe0, 0xc0, 0x2b, 0x80, 0x6b, 0x4b, 0xa0},
+    {0x00, 0xf6, 0xf1, 0x07, 0xff, 0x09, 0x0e, 0xf8,
+     0xe3, 0x15, 0x12, 0xe4, 0x1c, 0xea, 0xed, 0x1b,
+     0x00, 0xdb, 0xab, 0x70, 0x4b, 0x90, 0xe0, 0x3b,
+     0x96, 0x4d, 0x3d, 0xe6, 0xdd, 0x06, 0x76, 0xad},
+    {0x00, 0xf7, 0xf3, 0x04, 0xfb, 0x0c, 0x08, 0xff,
+     0xeb, 0x1c, 0x18, 0xef, 0x10, 0xe7, 0xe3, 0x14,
+     0x00, 0xcb, 0x8b, 0x40, 0x0b, 0xc0, 0x80, 0x4b,
+     0x16, 0xdd, 0x9d, 0x56, 0x1d, 0xd6, 0x96, 0x5d},
+    {0x00, 0xf8, 0xed, 0x15, 0xc7, 0x3f, 0x2a, 0xd2,
+     0x93, 0x6b, 0x7e, 0x86, 0x54, 0xac, 0xb9, 0x41,
+     0x00, 0x3b, 0x76, 0x4d, 0xec, 0xd7, 0x9a, 0xa1,
+     0xc5, 0xfe, 0xb3, 0x88, 0x29, 0x12, 0x5f, 0x64},
+    {0x00, 0xf9, 0xef, 0x16, 0xc3, 0x3a, 0x2c, 0xd5,
+     0x9b, 0x62, 0x74, 0x8d, 0x58, 0xa1, 0xb7, 0x4e,
+     0x00, 0x2b, 0x56, 0x7d, 0xac, 0x87, 0xfa, 0xd1,
+     0x45, 0x6e, 0x13, 0x38, 0xe9, 0xc2, 0xbf, 0x94},
+    {0x00, 0xfa, 0xe9, 0x13, 0xcf, 0x35, 0x26, 0xdc,
+     0x83, 0x79, 0x6a, 0x90, 0x4c, 0xb6, 0xa5, 0x5f,
+     0x00, 0x1b, 0x36, 0x2d, 0x6c, 0x77, 0x5a, 0x41,
+     0xd8, 0xc3, 0xee, 0xf5, 0xb4, 0xaf, 0x82, 0x99},
+    {0x00, 0xfb, 0xeb, 0x10, 0xcb, 0x30, 0x20, 0xdb,
+     0x8b, 0x70, 0x60, 0x9b, 0x40, 0xbb, 0xab, 0x50,
+     0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31,
+     0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69},
+    {0x00, 0xfc, 0xe5, 0x19, 0xd7, 0x2b, 0x32, 0xce,
+     0xb3, 0x4f, 0x56, 0xaa, 0x64, 0x98, 0x81, 0x7d,
+     0x00, 0x7b, 0xf6, 0x8d, 0xf1, 0x8a, 0x07, 0x7c,
+     0xff, 0x84, 0x09, 0x72, 0x0e, 0x75, 0xf8, 0x83},
+    {0x00, 0xfd, 0xe7, 0x1a, 0xd3, 0x2e, 0x34, 0xc9,
+     0xbb, 0x46, 0x5c, 0xa1, 0x68, 0x95, 0x8f, 0x72,
+     0x00, 0x6b, 0xd6, 0xbd, 0xb1, 0xda, 0x67, 0x0c,
+     0x7f, 0x14, 0xa9, 0xc2, 0xce, 0xa5, 0x18, 0x73},
+    {0x00, 0xfe, 0xe1, 0x1f, 0xdf, 0x21, 0x3e, 0xc0,
+     0xa3, 0x5d, 0x42, 0xbc, 0x7c, 0x82, 0x9d, 0x63,
+     0x00, 0x5b, 0xb6, 0xed, 0x71, 0x2a, 0xc7, 0x9c,
+     0xe2, 0xb9, 0x54, 0x0f, 0x93, 0xc8, 0x25, 0x7e},
+    {0x00, 0xff, 0xe3, 0x1c, 0xdb, 0x24, 0x38, 0xc7,
+     0xab, 0x54, 0x48, 0xb7, 0x70, 0x8f, 0x93, 0x6c,
+     0x00, 0x4b, 0x96, 0xdd, 0x31, 0x7a, 0xa7, 0xec,
+     0x62, 0x29, 0xf4, 0xbf, 0x53, 0x18, 0xc5, 0x8e},
+};
+
+#define MAX_GENERATOR_POLYNOMIAL_DEGREE 30
+
+// gfGeneratorPolynomials[n][j] is the coefficient of x^(n - j) in the
+// generator polynomial of degree n, for n <= 30.
+static const unsigned char gfGeneratorPolynomials[31][31] = {
+    {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x07, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x0f, 0x36, 0x78, 0x40, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x1f, 0xc6, 0x3f, 0x93, 0x74, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x3f, 0x01, 0xda, 0x20, 0xe3, 0x26, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x7f, 0x7a, 0x9a, 0xa4, 0x0b, 0x44, 0x75,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xff, 0x0b, 0x51, 0x36, 0xef, 0xad, 0xc8,
+     0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xe2, 0xcf, 0x9e, 0xf5, 0xeb, 0xa4, 0xe8,
+     0xc5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xd8, 0xc2, 0x9f, 0x6f, 0xc7, 0x5e, 0x5f,
+     0x71, 0x9d, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xac, 0x82, 0xa3, 0x32, 0x7b, 0xdb, 0xa2,
+     0xf8, 0x90, 0x74, 0xa0, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x44, 0x77, 0x43, 0x76, 0xdc, 0x1f, 0x07,
+     0x54, 0x5c, 0x7f, 0xd5, 0x61, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x89, 0x49, 0xe3, 0x11, 0xb1, 0x11, 0x34,
+     0x0d, 0x2e, 0x2b, 0x53, 0x84, 0x78, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x0e, 0x36, 0x72, 0x46, 0xae, 0x97, 0x2b,
+     0x9e, 0xc3, 0x7f, 0xa6, 0xd2, 0xea, 0xa3, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x1d, 0xc4, 0x6f, 0xa3, 0x70, 0x4a, 0x0a,
+     0x69, 0x69, 0x8b, 0x84, 0x97, 0x20, 0x86, 0x1a,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x3b, 0x0d, 0x68, 0xbd, 0x44, 0xd1, 0x1e,
+     0x08, 0xa3, 0x41, 0x29, 0xe5, 0x62, 0x32, 0x24,
+     0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x77, 0x42, 0x53, 0x78, 0x77, 0x16, 0xc5,
+     0x53, 0xf9, 0x29, 0x8f, 0x86, 0x55, 0x35, 0x7d,
+     0x63, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xef, 0xfb, 0xb7, 0x71, 0x95, 0xaf, 0xc7,
+     0xd7, 0xf0, 0xdc, 0x49, 0x52, 0xad, 0x4b, 0x20,
+     0x43, 0xd9, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xc2, 0x08, 0x1a, 0x92, 0x14, 0xdf, 0xbb,
+     0x98, 0x55, 0x73, 0xee, 0x85, 0x92, 0x6d, 0xad,
+     0x8a, 0x21, 0xac, 0xb3, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x98, 0xb9, 0xf0, 0x05, 0x6f, 0x63, 0x06,
+     0xdc, 0x70, 0x96, 0x45, 0x24, 0xbb, 0x16, 0xe4,
+     0xc6, 0x79, 0x79, 0xa5, 0xae, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x2c, 0xf3, 0x0d, 0x83, 0x31, 0x84, 0xc2,
+     0x43, 0xd6, 0x1c, 0x59, 0x7c, 0x52, 0x9e, 0xf4,
+     0x25, 0xec, 0x8e, 0x52, 0xff, 0x59, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x59, 0xb3, 0x83, 0xb0, 0xb6, 0xf4, 0x13,
+     0xbd, 0x45, 0x28, 0x1c, 0x89, 0x1d, 0x7b, 0x43,
+     0xfd, 0x56, 0xda, 0xe6, 0x1a, 0x91, 0xf5, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xb3, 0x44, 0x9a, 0xa3, 0x8c, 0x88, 0xbe,
+     0x98, 0x19, 0x55, 0x13, 0x03, 0xc4, 0x1b, 0x71,
+     0xc6, 0x12, 0x82, 0x02, 0x78, 0x5d, 0x29, 0x47,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x7a, 0x76, 0xa9, 0x46, 0xb2, 0xed, 0xd8,
+     0x66, 0x73, 0x96, 0xe5, 0x49, 0x82, 0x48, 0x3d,
+     0x2b, 0xce, 0x01, 0xed, 0xf7, 0x7f, 0xd9, 0x90,
+     0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xf5, 0x31, 0xe4, 0x35, 0xd7, 0x06, 0xcd,
+     0xd2, 0x26, 0x52, 0x38, 0x50, 0x61, 0x8b, 0x51,
+     0x86, 0x7e, 0xa8, 0x62, 0xe2, 0x7d, 0x17, 0xab,
+     0xad, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xf6, 0x33, 0xb7, 0x04, 0x88, 0x62, 0xc7,
+     0x98, 0x4d, 0x38, 0xce, 0x18, 0x91, 0x28, 0xd1,
+     0x75, 0xe9, 0x2a, 0x87, 0x44, 0x46, 0x90, 0x92,
+     0x4d, 0x2b, 0x5e, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0xf0, 0x3d, 0x1d, 0x91, 0x90, 0x75, 0x96,
+     0x30, 0x3a, 0x8b, 0x5e, 0x86, 0xc1, 0x69, 0x21,
+     0xa9, 0xca, 0x66, 0x7b, 0x71, 0xc3, 0x19, 0xd5,
+     0x06, 0x98, 0xa4, 0xd9, 0x00, 0x00, 0x00},
+    {0x01, 0xfc, 0x09, 0x1c, 0x0d, 0x12, 0xfb, 0xd0,
+     0x96, 0x67, 0xae, 0x64, 0x29, 0xa7, 0x0c, 0xf7,
+     0x38, 0x75, 0x77, 0xe9, 0x7f, 0xb5, 0x64, 0x79,
+     0x93, 0xb0, 0x4a, 0x3a, 0xc5, 0x00, 0x00},
+    {0x01, 0xe4, 0xc1, 0xc4, 0x30, 0xaa, 0x56, 0x50,
+     0xd9, 0x36, 0x8f, 0x4f, 0x20, 0x58, 0xff, 0x57,
+     0x18, 0x0f, 0xfb, 0x55, 0x52, 0xc9, 0x3a, 0x70,
+     0xbf, 0x99, 0x6c, 0x84, 0x8f, 0xaa, 0x00},
+    {0x01, 0xd4, 0xf6, 0x4d, 0x49, 0xc3, 0xc0, 0x4b,
+     0x62, 0x05, 0x46, 0x67, 0xb1, 0x16, 0xd9, 0x8a,
+     0x33, 0xb5, 0xf6, 0x48, 0x19, 0x12, 0x2e, 0xe4,
+     0x4a, 0xd8, 0xc3, 0x0b, 0x6a, 0x82, 0x96},
+};
+
+#endif  // GF_TABLES_H_
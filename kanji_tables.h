@@ -0,0 +1,1186 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Generated by tools/gen_kanji_tables.py. Do not edit.
+
+#ifndef KANJI_TABLES_H_
+#define KANJI_TABLES_H_
+
+#include <stdint.h>
+
+#define KANJI_BLOCK_BITS 6
+
+// A block of 2^KANJI_BLOCK_BITS code points: bit j of mask is set if
+// its code point j has a value in Kanji mode, and the values of the
+// code points of the block start at kanjiValues[firstValue].
+typedef struct {
+  uint64_t mask;
+  uint16_t firstValue;
+} KanjiBlock;
+
+// kanjiBlockIndex[c >> KANJI_BLOCK_BITS] is 1 + the index in
+// kanjiBlocks of the block of the code point c, or 0 if none of its
+// code points has a value in Kanji mode.
+static const uint16_t kanjiBlockIndex[1024] = {
+    0x000, 0x000, 0x001, 0x002, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x003, 0x004, 0x005, 0x006, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000,
+    0x000, 0x000, 0x008, 0x000, 0x009, 0x00a, 0x00b, 0x00c, 0x00d, 0x000,
+    0x00e, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00f, 0x010,
+    0x011, 0x012, 0x013, 0x014, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x015, 0x016, 0x017, 0x018, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x019, 0x01a, 0x01b, 0x01c, 0x01d, 0x01e, 0x01f, 0x020,
+    0x021, 0x022, 0x023, 0x024, 0x025, 0x026, 0x027, 0x028, 0x029, 0x02a,
+    0x02b, 0x02c, 0x02d, 0x02e, 0x02f, 0x030, 0x031, 0x032, 0x033, 0x034,
+    0x035, 0x036, 0x037, 0x038, 0x039, 0x03a, 0x03b, 0x03c, 0x03d, 0x03e,
+    0x03f, 0x040, 0x041, 0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048,
+    0x049, 0x04a, 0x04b, 0x04c, 0x04d, 0x04e, 0x04f, 0x050, 0x051, 0x052,
+    0x053, 0x054, 0x055, 0x056, 0x057, 0x058, 0x059, 0x05a, 0x05b, 0x05c,
+    0x05d, 0x05e, 0x05f, 0x060, 0x061, 0x062, 0x063, 0x064, 0x065, 0x066,
+    0x067, 0x068, 0x069, 0x06a, 0x06b, 0x06c, 0x06d, 0x06e, 0x06f, 0x070,
+    0x071, 0x072, 0x073, 0x074, 0x075, 0x076, 0x077, 0x078, 0x079, 0x07a,
+    0x07b, 0x07c, 0x07d, 0x07e, 0x07f, 0x080, 0x081, 0x082, 0x083, 0x084,
+    0x085, 0x086, 0x087, 0x088, 0x089, 0x08a, 0x08b, 0x08c, 0x08d, 0x08e,
+    0x08f, 0x090, 0x091, 0x092, 0x093, 0x094, 0x095, 0x096, 0x097, 0x098,
+    0x099, 0x09a, 0x09b, 0x09c, 0x09d, 0x09e, 0x09f, 0x0a0, 0x0a1, 0x0a2,
+    0x0a3, 0x0a4, 0x0a5, 0x0a6, 0x0a7, 0x0a8, 0x0a9, 0x0aa, 0x0ab, 0x0ac,
+    0x0ad, 0x0ae, 0x0af, 0x0b0, 0x0b1, 0x0b2, 0x0b3, 0x0b4, 0x0b5, 0x0b6,
+    0x0b7, 0x0b8, 0x0b9, 0x0ba, 0x0bb, 0x0bc, 0x0bd, 0x0be, 0x0bf, 0x0c0,
+    0x0c1, 0x0c2, 0x0c3, 0x0c4, 0x0c5, 0x0c6, 0x0c7, 0x0c8, 0x0c9, 0x0ca,
+    0x0cb, 0x0cc, 0x0cd, 0x0ce, 0x0cf, 0x0d0, 0x0d1, 0x0d2, 0x0d3, 0x0d4,
+    0x0d5, 0x0d6, 0x0d7, 0x0d8, 0x0d9, 0x0da, 0x0db, 0x000, 0x0dc, 0x0dd,
+    0x0de, 0x0df, 0x0e0, 0x0e1, 0x0e2, 0x0e3, 0x0e4, 0x0e5, 0x0e6, 0x0e7,
+    0x0e8, 0x0e9, 0x0ea, 0x0eb, 0x0ec, 0x0ed, 0x0ee, 0x0ef, 0x0f0, 0x0f1,
+    0x0f2, 0x0f3, 0x0f4, 0x0f5, 0x0f6, 0x0f7, 0x0f8, 0x0f9, 0x0fa, 0x0fb,
+    0x0fc, 0x0fd, 0x0fe, 0x0ff, 0x100, 0x101, 0x102, 0x103, 0x104, 0x105,
+    0x106, 0x107, 0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x000,
+    0x10f, 0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117, 0x118,
+    0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f, 0x120, 0x121, 0x122,
+    0x123, 0x124, 0x125, 0x126, 0x127, 0x128, 0x129, 0x12a, 0x12b, 0x12c,
+    0x12d, 0x12e, 0x12f, 0x130, 0x131, 0x000, 0x000, 0x132, 0x133, 0x134,
+    0x135, 0x136, 0x137, 0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e,
+    0x13f, 0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147, 0x148,
+    0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x000, 0x14f, 0x150, 0x151,
+    0x152, 0x153, 0x154, 0x155, 0x156, 0x157, 0x158, 0x159, 0x15a, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x15b, 0x15c, 0x000, 0x15d,
+};
+
+static const KanjiBlock kanjiBlocks[349] = {
+    {0x0053118c00000000, 0}, {0x0080000000800000, 9},
+    {0xfffe03fbfffe0000, 11}, {0x00000000000003fb, 50},
+    {0xffffffffffff0002, 59}, {0x000000000002ffff, 108},
+    {0x080d006333610000, 125}, {0x0000080000000008, 140},
+    {0x00000000000f0000, 142}, {0x0000000000140000, 146},
+    {0x20301f816404098d, 148}, {0x00000cc300040000, 168},
+    {0x00000020000000cc, 175}, {0x0000000000040000, 180},
+    {0x999999393999900f, 181}, {0x0000000000000804, 211},
+    {0x300c000300000000, 213}, {0x000080000000c8c0, 219},
+    {0x0000000000000060, 225}, {0x0000a40000000005, 227},
+    {0x00000000103fffef, 232}, {0xfffffffffffffffe, 254},
+    {0xfffffffe780fffff, 317}, {0x787fffffffffffff, 372},
+    {0x9b46244243f36f8b, 431}, {0x400a0004e3e0e82c, 462},
+    {0x04497977db365f65, 481}, {0x08c56038e3f0ecd7, 516},
+    {0x355180003403e602, 546}, {0x986982007eabe0c8, 565},
+    {0x8060e8032942a948, 591}, {0x4568c03aad93441c, 611},
+    {0x02403f7a8656aa60, 637}, {0x2174102014618388, 663},
+    {0x40bc300007022021, 681}, {0x0a2060a84462a624, 696},
+    {0x9c84040285740217, 715}, {0x11e27f2414157bfb, 735},
+    {0x20ff1f7502efb665, 768}, {0x676326c338403a70, 804},
+    {0x0fc946b020924dd9, 831}, {0xa03f86384850bc98, 858},
+    {0x52323e0988162388, 884}, {0xc72c00dde3a422aa, 907},
+    {0x8f0a840b26e1a166, 935}, {0x89bbc241559e27eb, 961},
+    {0x0849636185400014, 994}, {0x05cfff3e8ad07f0c, 1011},
+    {0x7b407a41a803ff1a, 1047}, {0x38eb050080024745, 1077},
+    {0x710c99340005d851, 1097}, {0x2404636601000397, 1119},
+    {0x430ac000005180d0, 1138}, {0x5800000830c89071, 1152},
+    {0x00415f80f7000e99, 1167}, {0x62800018941000b0, 1190},
+    {0x0156820009d00240, 1203}, {0x05101d1008015004, 1217},
+    {0x10504025001084c1, 1230}, {0xa60d40094d8a410f, 1243},
+    {0x098121c0914cab19, 1266}, {0x800006520003c485, 1288},
+    {0x0009041d00080b04, 1302}, {0x16900009905c4849, 1314},
+    {0x2433841222200c65, 1332}, {0x42250a0447960c03, 1351},
+    {0x4f08490090880028, 1371}, {0x3e87d830d3aa14a2, 1386},
+    {0x41867ea41f618604, 1415}, {0x211857a505b3c390, 1441},
+    {0x4a0411282a48241e, 1467}, {0x88400d60161b0a40, 1486},
+    {0x106082219502020a, 1504}, {0x8000144404000243, 1519},
+    {0x700000000c040000, 1529}, {0x0c00024a00c11a06, 1535},
+    {0x4045140400401a00, 1549}, {0x052b0a78bdb30029, 1560},
+    {0x8379407cbfa0bba9, 1586}, {0xc5694bf6e81d12fc, 1619},
+    {0xff022115044aeff6, 1653}, {0x0242d033402bed63, 1684},
+    {0x59ca1b0200131000, 1709}, {0x2c41a703020000a0, 1726},
+    {0x000002048ff24880, 1741}, {0x0048920010055800, 1756},
+    {0x3480500420011894, 1767}, {0x68be49ea684c3200, 1781},
+    {0x21c9a8202e42184c, 1807}, {0xff7c001e80b050b9, 1828},
+    {0x01e028c114e0849a, 1856}, {0xdddb130fac49870e, 1876},
+    {0x51a2a2e089fbbe1a, 1909}, {0x928b3e4632ca5502, 1940},
+    {0x32186703438f1dbf, 1967}, {0xa923081133c03028, 1998},
+    {0x04028fe33a65c000, 2018}, {0x00a1bf3d86252c4e, 2040},
+    {0x317c06c98cd43a1a, 2068}, {0x0edb018b950a00e0, 2096},
+    {0xf01011828c20e34b, 2119}, {0x40fbc9aca7287d94, 2141},
+    {0x44445a9006534484, 2173}, {0xf5d4004800013fc8, 2193},
+    {0x891dc442ec577701, 2215}, {0xd242410949286b83, 2244},
+    {0x3a22180059fe061d, 2267}, {0xc0eaf0033b9fb7e4, 2292},
+    {0xe400898082021386, 2326}, {0x0cc44b8010a1b200, 2343},
+    {0x48341faf8944d309, 2361}, {0x0450420a0c458259, 2389},
+    {0x4450314010c8a040, 2407}, {0x0540828001004004, 2422},
+    {0x1a056a30442c0108, 2431}, {0x645690cf051420a6, 2449},
+    {0xcbf09c1831000021, 2473}, {0x01b5104c63e2a120, 2493},
+    {0x3281b8b29a83538c, 2515}, {0x0c0233e70a84987a, 2542},
+    {0x9070a1a19018d4cc, 2567}, {0x0451c3d4e0048a1e, 2590},
+    {0x5310484421c2439a, 2613}, {0xf3bd024136400292, 2634},
+    {0xa5d27dc0e8f0ab09, 2658}, {0xd0afa43fd24bc242, 2689},
+    {0x03d8824734a11aa0, 2720}, {0xc83ad294651bc452, 2743},
+    {0x33140e0640c8001c, 2771}, {0xc0d00088b21b614f, 2789},
+    {0x166ba1c5a898a02a, 2812}, {0x0604c08b85b42e50, 2838},
+    {0xa251056e1e04f933, 2860}, {0x73b8ec0776380400, 2888},
+    {0xc816408118324406, 2914}, {0xaa04298063097c8a, 2932},
+    {0x27604e0eca9c1c24, 2955}, {0x8104004683000990, 2981},
+    {0x0908540d10816011, 2994}, {0x0c000500cc0a000e, 3010},
+    {0x6784008ba0440430, 3023}, {0x8b18865e8a195288, 3041},
+    {0x9cbe8c1041602e59, 3066}, {0x00089800891c6861, 3092},
+    {0x41900018089a8100, 3108}, {0x640d0505e4a14007, 3121},
+    {0xff0a48060e4d310e, 3142}, {0x000b852e2aa81632, 3169},
+    {0x696c0e20ca841800, 3191}, {0x0390565816000032, 3211},
+    {0x112480001a285120, 3228}, {0x0eaa5d52432618e1, 3242},
+    {0x4500fa7bae280fa0, 3269}, {0xc044c88089406408, 3297},
+    {0x24c48424b1419005, 3313}, {0xc1949000603a1a34, 3332},
+    {0xc106180d003a8246, 3352}, {0x1511e05099100022, 3371},
+    {0x020a041a00824057, 3388}, {0x444ad8138930004f, 3403},
+    {0x400510c0ed228a02, 3425}, {0x3101880801021000, 3443},
+    {0x0708f00002044600, 3453}, {0x22020000a2008900, 3466},
+    {0x1040004216100200, 3475}, {0x200052f402605200, 3484},
+    {0x4202110082308510, 3499}, {0x9a2070e180b54308, 3512},
+    {0xfc65350008012040, 3534}, {0x62140286ab0419c1, 3552},
+    {0x0244908500440087, 3573}, {0x338032070a85405c, 3587},
+    {0xc0d0ce20b8c00400, 3608}, {0x0d2505080080c030, 3626},
+    {0x080c020000400a90, 3640}, {0x4102642140006505, 3649},
+    {0x847c002400000268, 3664}, {0x40498619de200002, 3677},
+    {0x2001008440000808, 3695}, {0x01c742cd10108400, 3702},
+    {0x1d8f1968d52a7038, 3719}, {0x81d92ef53e12be50, 3748},
+    {0x732e08282412cec4, 3780}, {0xd41d020c4b3424ac, 3804},
+    {0x0811009780002a02, 3828}, {0x7d451786114411c4, 3841},
+    {0x87914000064949d9, 3866}, {0x491444bad8c4254c, 3887},
+    {0x15800271c8001b92, 3912}, {0xc200096a0c000081, 3931},
+    {0xba49302140024800, 3944}, {0x1008e2ac1c802080, 3960},
+    {0x841400e100341004, 3976}, {0x1014980020000020, 3989},
+    {0x5420868804aa70c2, 3997}, {0x2010918004130c62, 4017},
+    {0x54001c4002064082, 4032}, {0x84802125e4e90383, 4045},
+    {0xe60944c02000e433, 4067}, {0x080112da81260a03, 4087},
+    {0xf886400197906901, 4105}, {0xa6510a0e0081e24d, 4127},
+    {0x8441c60081ec011a, 4149}, {0x8741a46fb62cadb8, 4168},
+    {0x026811614b028d54, 4200}, {0x043350a02057bb60, 4221},
+    {0x01122402b7b4a8c0, 4244}, {0x00c8227120009ad3, 4265},
+    {0xe1800c8a809e2081, 4284}, {0x402810318151b009, 4303},
+    {0x620e69b689a52a0e, 4320}, {0x4d548085d1444425, 4348},
+    {0x862dd8071fb12c75, 4370}, {0x226e414e4841d87c, 4401},
+    {0xed37f80c9e088200, 4427}, {0x0814931375268c80, 4453},
+    {0x6ea6484ec8040e32, 4475}, {0xba0126c066702c4a, 4500},
+    {0x00000000185dd30c, 4524}, {0x0540000000000000, 4538},
+    {0x03a54f8181337020, 4541}, {0x2344c318641055ec, 4564},
+    {0x1a090a4300341462, 4588}, {0xa848010213a5187b, 4606},
+    {0xe2dd8106c5440440, 4628}, {0x0416b6262d481af0, 4650},
+    {0x311280326e405058, 4675}, {0x420a82080c0007e4, 4695},
+    {0x87134860803b4840, 4711}, {0xe52903193428850d, 4731},
+    {0x5c1825a9870a2345, 4755}, {0x03e85e00d9c577a6, 4780},
+    {0x41c6cd54a7000081, 4810}, {0x2b0ab860a2042800, 4831},
+    {0x0e1a08eada9e0020, 4849}, {0x0376890811c0427c, 4872},
+    {0x18a8000001058621, 4894}, {0x20220d05c44846a0, 4907},
+    {0x28978a0191485422, 4925}, {0x3122160500087898, 4946},
+    {0x06a2fa4e08804240, 4964}, {0x9b04200292110814, 4984},
+    {0x9010500006432e52, 5000}, {0x2020304285ba0041, 5017},
+    {0x4080270805a04f0b, 5033}, {0x0600df501a930591, 5052},
+    {0x4e8006303021a202, 5075}, {0x8001a00404c80cc4, 5092},
+    {0x0a020880d4316000, 5106}, {0x00418e1800281c00, 5120},
+    {0x4b00f210ca106ad0, 5133}, {0x889002201506274d, 5155},
+    {0x8150454982a85a00, 5174}, {0x2c08880480002004, 5193},
+    {0x4ac48001000508d1, 5203}, {0x0a42008e0062e020, 5218},
+    {0xe0a5090e6a8c3055, 5233}, {0x80b3481442c42906, 5258},
+    {0x731c0102b330803e, 5278}, {0x09400c20600d1494, 5301},
+    {0xc094a451c040301a, 5317}, {0xa40c96c205c88dca, 5336},
+    {0x011000c834040001, 5361}, {0x1c5a2428a9c9550d, 5371},
+    {0x100f7a4d48370142, 5397}, {0x9205317b452a32b4, 5421},
+    {0x458a68d75c44b894, 5448}, {0x420819432ed15097, 5476},
+    {0x209798409d40d202, 5500}, {0x00000000064d5409, 5521},
+    {0x8480000000000000, 5532}, {0x17001c0604215542, 5535},
+    {0xb9ddff8761107624, 5553}, {0x3c00245d5c0a659f, 5587},
+    {0x000000000059adb0, 5614}, {0x009b28d000000000, 5626},
+    {0x4408010802000422, 5636}, {0x90288d0aac409804, 5645},
+    {0x00310400e0018700, 5664}, {0x1054001982211794, 5676},
+    {0x40039c02021a2cb2, 5694}, {0x7900080c88043d60, 5713},
+    {0xcb088640ba3c1628, 5731}, {0x0000001e90807274, 5755},
+    {0x9c87e188d8000000, 5770}, {0x2791ae6404124034, 5788},
+    {0x5366408fe6fbe86b, 5810}, {0xb5e4e32b537feea6, 5845},
+    {0x012285480002869f, 5884}, {0x20a0211608004402, 5902},
+    {0x0005200002040004, 5914}, {0x01ac162c01547e00, 5920},
+    {0x05308c1410852a84, 5941}, {0x906000cab943fbc3, 5959},
+    {0x8090120040326000, 5986}, {0x400200544c810b30, 5997},
+    {0x028020001d6a0029, 6012}, {0x150c261000048000, 6026},
+    {0x0c24d94d07018040, 6037}, {0x5020500118502810, 6056},
+    {0x0201708004d01000, 6069}, {0x0000013221c30108, 6080},
+    {0x0560080207190088, 6092}, {0xf0a104054c0e0012, 6106},
+    {0x0000000000000002, 6124}, {0x0080000000000000, 6125},
+    {0x5a0421bd035a8e8d, 6126}, {0x0000002611703488, 6153},
+    {0x8804c50210000000, 6166}, {0x25ed147cf801b815, 6175},
+    {0x1bd705891bb0ed60, 6204}, {0x0ac50d0c1a627af3, 6234},
+    {0x63050490524ae5d1, 6262}, {0x16122b5752440354, 6286},
+    {0x001829491101a872, 6310}, {0x886c600010080948, 6328},
+    {0x39903012058f916e, 6342}, {0x001b88804930f840, 6367},
+    {0x0042850000000000, 6385}, {0x7014ea0498000058, 6390},
+    {0x60005113611d1628, 6407}, {0x0000000000a71a24, 6427},
+    {0x1018712003c00000, 6437}, {0x89066004a9270172, 6449},
+    {0x40810900020cc022, 6470}, {0x00000e348ca0202d, 6482},
+    {0x1101210000000000, 6498}, {0x0892ec4cc11a8011, 6503},
+    {0x1806c7ac85000040, 6524}, {0x001080000512e03e, 6541},
+    {0x02106d0180ce4008, 6555}, {0x0027011e08568641, 6571},
+    {0x4e05e032083d3750, 6590}, {0x01400081048401c0, 6615},
+    {0x00591aa000000000, 6625}, {0xc8001d48882443c8, 6634},
+    {0x0404901372030152, 6653}, {0x0d148a1004008280, 6670},
+    {0x2704a04002088056, 6683}, {0x000000004c000000, 6698},
+    {0xa320000000000000, 6701}, {0xdf002660a0ae1902, 6706},
+    {0x3ad081217b15f010, 6729}, {0x4800100300284180, 6754},
+    {0x00c414cf8014cc00, 6764}, {0x0000000130202000, 6782},
+    {0xffffffffffffdf7a, 6787}, {0x000000003fffffff, 6847},
+    {0x0000002800000000, 6877},
+};
+
+// 13-bit values in Kanji mode, see 7.4.6, in the order of the code
+// points they belong to.
+static const uint16_t kanjiValues[6879] = {
+    0x0051, 0x0052, 0x0058, 0x000e, 0x008a, 0x004b, 0x003d, 0x000c,
+    0x00b7, 0x003e, 0x0040, 0x01df, 0x01e0, 0x01e1, 0x01e2, 0x01e3,
+    0x01e4, 0x01e5, 0x01e6, 0x01e7, 0x01e8, 0x01e9, 0x01ea, 0x01eb,
+    0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01f0, 0x01f1, 0x01f2, 0x01f3,
+    0x01f4, 0x01f5, 0x01f6, 0x01ff, 0x0200, 0x0201, 0x0202, 0x0203,
+    0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020a, 0x020b,
+    0x020c, 0x020d, 0x020e, 0x020f, 0x0210, 0x0211, 0x0212, 0x0213,
+    0x0214, 0x0215, 0x0216, 0x0246, 0x0240, 0x0241, 0x0242, 0x0243,
+    0x0244, 0x0245, 0x0247, 0x0248, 0x0249, 0x024a, 0x024b, 0x024c,
+    0x024d, 0x024e, 0x024f, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254,
+    0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025a, 0x025b, 0x025c,
+    0x025d, 0x025e, 0x025f, 0x0260, 0x0270, 0x0271, 0x0272, 0x0273,
+    0x0274, 0x0275, 0x0277, 0x0278, 0x0279, 0x027a, 0x027b, 0x027c,
+    0x027d, 0x027e, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028a, 0x028b, 0x028c, 0x028d,
+    0x028e, 0x028f, 0x0290, 0x0291, 0x0276, 0x001d, 0x001c, 0x0021,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x00b5, 0x00b6, 0x0024, 0x0023,
+    0x00b1, 0x004c, 0x004d, 0x0066, 0x004e, 0x00b0, 0x0069, 0x006a,
+    0x0068, 0x006b, 0x008b, 0x008c, 0x008d, 0x009d, 0x008e, 0x009e,
+    0x0078, 0x0079, 0x003c, 0x00a3, 0x00a5, 0x0047, 0x009a, 0x0088,
+    0x0089, 0x007f, 0x007e, 0x00a7, 0x00a8, 0x0048, 0x00a6, 0x00a4,
+    0x00a0, 0x0042, 0x009f, 0x0045, 0x0046, 0x00a1, 0x00a2, 0x007c,
+    0x007d, 0x007a, 0x007b, 0x009b, 0x009c, 0x029f, 0x02aa, 0x02a0,
+    0x02ab, 0x02a1, 0x02ac, 0x02a2, 0x02ad, 0x02a4, 0x02af, 0x02a3,
+    0x02ae, 0x02a5, 0x02ba, 0x02b5, 0x02b0, 0x02a7, 0x02bc, 0x02b7,
+    0x02b2, 0x02a6, 0x02b6, 0x02bb, 0x02b1, 0x02a8, 0x02b8, 0x02bd,
+    0x02b3, 0x02a9, 0x02b9, 0x02be, 0x02b4, 0x0061, 0x0060, 0x0063,
+    0x0062, 0x0065, 0x0064, 0x005f, 0x005e, 0x005b, 0x005d, 0x005c,
+    0x00bc, 0x005a, 0x0059, 0x004a, 0x0049, 0x00b4, 0x00b3, 0x00b2,
+    0x0000, 0x0001, 0x0002, 0x0016, 0x0018, 0x0019, 0x001a, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+    0x003a, 0x0067, 0x006c, 0x002b, 0x002c, 0x0020, 0x011f, 0x0120,
+    0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128,
+    0x0129, 0x012a, 0x012b, 0x012c, 0x012d, 0x012e, 0x012f, 0x0130,
+    0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138,
+    0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013f, 0x0140,
+    0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148,
+    0x0149, 0x014a, 0x014b, 0x014c, 0x014d, 0x014e, 0x014f, 0x0150,
+    0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158,
+    0x0159, 0x015a, 0x015b, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160,
+    0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168,
+    0x0169, 0x016a, 0x016b, 0x016c, 0x016d, 0x016e, 0x016f, 0x0170,
+    0x0171, 0x000a, 0x000b, 0x0014, 0x0015, 0x0180, 0x0181, 0x0182,
+    0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018a,
+    0x018b, 0x018c, 0x018d, 0x018e, 0x018f, 0x0190, 0x0191, 0x0192,
+    0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0199, 0x019a,
+    0x019b, 0x019c, 0x019d, 0x019e, 0x019f, 0x01a0, 0x01a1, 0x01a2,
+    0x01a3, 0x01a4, 0x01a5, 0x01a6, 0x01a7, 0x01a8, 0x01a9, 0x01aa,
+    0x01ab, 0x01ac, 0x01ad, 0x01ae, 0x01af, 0x01b0, 0x01b1, 0x01b2,
+    0x01b3, 0x01b4, 0x01b5, 0x01b6, 0x01b7, 0x01b8, 0x01b9, 0x01ba,
+    0x01bb, 0x01bc, 0x01bd, 0x01be, 0x01c0, 0x01c1, 0x01c2, 0x01c3,
+    0x01c4, 0x01c5, 0x01c6, 0x01c7, 0x01c8, 0x01c9, 0x01ca, 0x01cb,
+    0x01cc, 0x01cd, 0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d2, 0x01d3,
+    0x01d4, 0x01d5, 0x01d6, 0x0005, 0x001b, 0x0012, 0x0013, 0x05ea,
+    0x0d1a, 0x0a35, 0x101c, 0x0b24, 0x09cf, 0x0b23, 0x067a, 0x0f33,
+    0x109e, 0x11a0, 0x060e, 0x070e, 0x11a1, 0x0ba2, 0x1280, 0x07b5,
+    0x0f78, 0x0b25, 0x10fc, 0x0f80, 0x11a2, 0x0d06, 0x11a3, 0x0838,
+    0x11a4, 0x075b, 0x0ccf, 0x0a65, 0x11a5, 0x11a6, 0x11a7, 0x0e54,
+    0x07b6, 0x0e56, 0x0e21, 0x08c1, 0x0fd2, 0x1b28, 0x11a8, 0x0b26,
+    0x11a9, 0x0673, 0x0823, 0x08ee, 0x1067, 0x13e4, 0x10d0, 0x0e3b,
+    0x0723, 0x0794, 0x11aa, 0x11ab, 0x10f9, 0x109c, 0x0c48, 0x11ad,
+    0x0a16, 0x0e31, 0x11b0, 0x061d, 0x08dd, 0x08dc, 0x05e4, 0x116a,
+    0x1169, 0x0971, 0x059f, 0x11b1, 0x11b2, 0x11b3, 0x0fd3, 0x11b4,
+    0x08f0, 0x05e5, 0x1012, 0x07dc, 0x07dd, 0x07de, 0x0d60, 0x10fa,
+    0x11b5, 0x11b6, 0x11b7, 0x0b6c, 0x0a99, 0x0b6d, 0x11bc, 0x11ba,
+    0x11bb, 0x07b7, 0x0961, 0x06ae, 0x11b9, 0x11b8, 0x0f67, 0x09e5,
+    0x09e4, 0x0c7c, 0x11bd, 0x0f34, 0x0be5, 0x0017, 0x11be, 0x11c0,
+    0x0ca3, 0x111f, 0x05c8, 0x11bf, 0x067c, 0x0802, 0x0d07, 0x088f,
+    0x11c1, 0x0e43, 0x0769, 0x11c2, 0x05c9, 0x08de, 0x076a, 0x0f5a,
+    0x0eb0, 0x07b8, 0x06af, 0x11e5, 0x0da0, 0x0e8c, 0x11c4, 0x0eba,
+    0x1120, 0x0b4c, 0x09e6, 0x0a17, 0x067e, 0x0d4f, 0x0cc1, 0x11c8,
+    0x05ca, 0x0d61, 0x0a9a, 0x0972, 0x1083, 0x0c8c, 0x067d, 0x11c7,
+    0x109d, 0x11c3, 0x11c5, 0x09ac, 0x11c6, 0x1383, 0x11ce, 0x11d1,
+    0x11cf, 0x0680, 0x0f79, 0x11c9, 0x11cd, 0x08f1, 0x09e7, 0x0724,
+    0x11d2, 0x11ca, 0x1121, 0x0a18, 0x11cb, 0x11d0, 0x11d3, 0x11cc,
+    0x07df, 0x05cb, 0x07e0, 0x067f, 0x1384, 0x1019, 0x0f4e, 0x08f2,
+    0x0b4e, 0x10f5, 0x0f96, 0x0857, 0x0c63, 0x06a2, 0x0ab2, 0x11d7,
+    0x11dc, 0x11da, 0x11d5, 0x0c6d, 0x11d8, 0x11db, 0x11d9, 0x0f9b,
+    0x11d6, 0x0b4d, 0x1013, 0x11dd, 0x11de, 0x0a83, 0x11eb, 0x0e6f,
+    0x0f15, 0x11e6, 0x0fae, 0x0674, 0x11ea, 0x11e4, 0x11ed, 0x0c31,
+    0x08c2, 0x0e7b, 0x17c5, 0x11ec, 0x0dbc, 0x11e1, 0x08f4, 0x08f3,
+    0x11df, 0x0a58, 0x11e7, 0x0fad, 0x0cec, 0x11e3, 0x0891, 0x11e0,
+    0x11e8, 0x11e2, 0x110f, 0x11e9, 0x1160, 0x0824, 0x0890, 0x11ee,
+    0x11ef, 0x11f3, 0x05cc, 0x0f8e, 0x11f2, 0x11f1, 0x11f5, 0x11f4,
+    0x0d62, 0x0892, 0x11f6, 0x0a43, 0x0c64, 0x0d63, 0x0834, 0x11f7,
+    0x0795, 0x11f8, 0x11fa, 0x0fd4, 0x0886, 0x09d0, 0x0ef5, 0x11f9,
+    0x0983, 0x10a2, 0x11fc, 0x1202, 0x11fb, 0x0982, 0x0add, 0x0858,
+    0x1203, 0x080d, 0x1200, 0x1201, 0x0ded, 0x0c5c, 0x07e1, 0x0fec,
+    0x1204, 0x10fb, 0x1205, 0x1208, 0x1206, 0x0c2d, 0x1207, 0x1209,
+    0x120b, 0x120a, 0x0f86, 0x0796, 0x120d, 0x120e, 0x066d, 0x120c,
+    0x0a72, 0x1211, 0x1210, 0x120f, 0x11d4, 0x1212, 0x0ade, 0x1213,
+    0x1084, 0x1057, 0x1215, 0x1214, 0x1217, 0x1216, 0x1218, 0x1219,
+    0x05f2, 0x08b3, 0x085a, 0x0a9b, 0x0d1b, 0x07e2, 0x0be6, 0x08f5,
+    0x094e, 0x121b, 0x1046, 0x0da5, 0x0a19, 0x121a, 0x121c, 0x0dbd,
+    0x0715, 0x121d, 0x0e3c, 0x0c13, 0x121f, 0x1220, 0x0eaa, 0x08f6,
+    0x115a, 0x1221, 0x07e4, 0x0f7a, 0x0c74, 0x082f, 0x0d94, 0x0893,
+    0x1222, 0x1223, 0x0e20, 0x063e, 0x1226, 0x09bb, 0x1225, 0x0984,
+    0x1227, 0x1a2c, 0x1228, 0x0fe0, 0x1229, 0x122a, 0x122b, 0x0b27,
+    0x0a4a, 0x0725, 0x122e, 0x122c, 0x103b, 0x122d, 0x0f39, 0x122f,
+    0x1230, 0x1231, 0x0dbe, 0x1235, 0x1233, 0x1234, 0x1232, 0x09a1,
+    0x1236, 0x1068, 0x1122, 0x1237, 0x0ba6, 0x1238, 0x0ab9, 0x1239,
+    0x0d1c, 0x10fd, 0x0dc0, 0x1283, 0x123a, 0x1f23, 0x0803, 0x123b,
+    0x0ffd, 0x0ac8, 0x0cba, 0x123d, 0x0e22, 0x123e, 0x1240, 0x06cd,
+    0x1241, 0x07e5, 0x0e0a, 0x065a, 0x0aaf, 0x0e9f, 0x1242, 0x0dc1,
+    0x0b6e, 0x1243, 0x0f6a, 0x0bd8, 0x0720, 0x0727, 0x1244, 0x1246,
+    0x0859, 0x1245, 0x1131, 0x0ac9, 0x0ebb, 0x0f8a, 0x1247, 0x10d8,
+    0x1248, 0x1249, 0x0dde, 0x124a, 0x0ba7, 0x09bc, 0x0894, 0x124b,
+    0x09e8, 0x094f, 0x0d64, 0x124d, 0x0c65, 0x09ad, 0x124e, 0x124f,
+    0x0c0f, 0x124c, 0x1251, 0x0fd5, 0x0944, 0x1250, 0x0895, 0x099c,
+    0x0e8d, 0x1254, 0x1252, 0x0f5b, 0x0b28, 0x125b, 0x0704, 0x1255,
+    0x1253, 0x0c2e, 0x1257, 0x1256, 0x06e3, 0x0880, 0x125c, 0x10eb,
+    0x1258, 0x125d, 0x125a, 0x1259, 0x110d, 0x08f7, 0x0681, 0x1132,
+    0x0ad5, 0x0db7, 0x0945, 0x1260, 0x1261, 0x1123, 0x114a, 0x1263,
+    0x08f8, 0x1262, 0x06ce, 0x1264, 0x0ff5, 0x0d3a, 0x1085, 0x0f97,
+    0x1265, 0x1dd3, 0x0dee, 0x1266, 0x0728, 0x1031, 0x0adf, 0x1267,
+    0x0fa5, 0x126b, 0x0ba8, 0x1268, 0x080e, 0x1269, 0x0729, 0x084d,
+    0x126c, 0x126d, 0x126e, 0x126f, 0x0a59, 0x08f9, 0x105c, 0x1066,
+    0x0e35, 0x0faf, 0x1270, 0x1271, 0x1273, 0x1275, 0x1274, 0x1276,
+    0x067b, 0x0feb, 0x09ba, 0x1277, 0x0c38, 0x0ae0, 0x07e7, 0x1278,
+    0x0ed9, 0x1279, 0x127a, 0x127b, 0x127c, 0x0f03, 0x0826, 0x05e3,
+    0x0dfd, 0x127d, 0x0a9c, 0x0be7, 0x127f, 0x127e, 0x0ae1, 0x08df,
+    0x1281, 0x0ebc, 0x1282, 0x0eda, 0x0c72, 0x0cac, 0x07e6, 0x0e2c,
+    0x0cd0, 0x0e8e, 0x0fed, 0x1284, 0x0be8, 0x0854, 0x1285, 0x1286,
+    0x060b, 0x05f3, 0x076b, 0x0c66, 0x07b0, 0x10d1, 0x1289, 0x0675,
+    0x1288, 0x07e8, 0x128a, 0x106f, 0x128b, 0x1110, 0x08fa, 0x08b4,
+    0x128c, 0x128e, 0x128d, 0x0b7e, 0x0618, 0x063d, 0x128f, 0x1290,
+    0x08b5, 0x1291, 0x07ce, 0x09d1, 0x1292, 0x1014, 0x0973, 0x07b9,
+    0x1086, 0x0c2f, 0x0ebd, 0x0a7b, 0x0aa6, 0x0a66, 0x0a73, 0x0ad6,
+    0x0ebe, 0x1295, 0x0622, 0x0c30, 0x08fb, 0x08c3, 0x0825, 0x1299,
+    0x0cc0, 0x0cbc, 0x07e9, 0x0ae2, 0x129a, 0x1298, 0x0682, 0x0ca4,
+    0x0a36, 0x09ea, 0x0605, 0x0710, 0x0946, 0x09e9, 0x129b, 0x129c,
+    0x07a8, 0x06e5, 0x0947, 0x07a7, 0x0d5d, 0x0604, 0x0def, 0x103c,
+    0x0900, 0x10d9, 0x0da6, 0x08fc, 0x084e, 0x12a5, 0x0821, 0x0fe9,
+    0x0edb, 0x12a4, 0x075c, 0x129f, 0x12a0, 0x12a2, 0x12a3, 0x07ba,
+    0x0b81, 0x0f6b, 0x12a1, 0x129d, 0x08e1, 0x129e, 0x1143, 0x0fb0,
+    0x0d66, 0x08e0, 0x0950, 0x12a6, 0x0e1b, 0x12aa, 0x0a7c, 0x0a74,
+    0x12ad, 0x12ab, 0x1021, 0x12a8, 0x12b1, 0x12ac, 0x12af, 0x08c4,
+    0x103d, 0x12b0, 0x12b2, 0x12b4, 0x09ae, 0x1161, 0x12a9, 0x12a7,
+    0x12b3, 0x12ae, 0x12b6, 0x12c2, 0x12b8, 0x12bc, 0x12c0, 0x12b9,
+    0x12dd, 0x09a7, 0x06d0, 0x12b7, 0x12c4, 0x05f4, 0x12c3, 0x05a3,
+    0x0f29, 0x12c1, 0x12ba, 0x12b5, 0x12bb, 0x0986, 0x12c5, 0x05f5,
+    0x12ce, 0x12c6, 0x12c7, 0x0ae3, 0x1009, 0x12cc, 0x12cb, 0x0d8e,
+    0x12cd, 0x12ca, 0x0613, 0x0974, 0x0b4f, 0x12c8, 0x0dc2, 0x12c9,
+    0x05a0, 0x12d3, 0x1082, 0x0ae5, 0x12d9, 0x12d8, 0x12cf, 0x0c81,
+    0x12d0, 0x0cad, 0x12d5, 0x0ae4, 0x12d2, 0x1062, 0x085b, 0x12d6,
+    0x12d7, 0x12d4, 0x12da, 0x12d1, 0x12e0, 0x12e5, 0x12e1, 0x12dc,
+    0x12e6, 0x0c10, 0x12e8, 0x0901, 0x12de, 0x0d1d, 0x12e2, 0x12db,
+    0x072b, 0x076c, 0x0705, 0x12e3, 0x12df, 0x0896, 0x12e9, 0x12e7,
+    0x0c32, 0x07a9, 0x07ea, 0x12e4, 0x0832, 0x0623, 0x12ed, 0x12eb,
+    0x1325, 0x12f0, 0x12ea, 0x12ee, 0x12ec, 0x09eb, 0x12ef, 0x12f2,
+    0x12f7, 0x12f5, 0x12f4, 0x0cd1, 0x0683, 0x12f1, 0x12f3, 0x0ae6,
+    0x0612, 0x12f6, 0x069c, 0x1302, 0x0b3a, 0x12fd, 0x12fb, 0x12fc,
+    0x12fe, 0x061c, 0x0c18, 0x12f8, 0x12f9, 0x071a, 0x1301, 0x076d,
+    0x1304, 0x1300, 0x1303, 0x0f6c, 0x0e13, 0x0eb6, 0x1306, 0x1305,
+    0x06e4, 0x1307, 0x130a, 0x1309, 0x1308, 0x0e58, 0x130b, 0x130c,
+    0x130e, 0x130d, 0x1310, 0x1313, 0x1311, 0x130f, 0x1312, 0x1314,
+    0x1315, 0x1316, 0x1317, 0x1318, 0x1224, 0x0a7a, 0x09ec, 0x06b1,
+    0x05f6, 0x0ce3, 0x1319, 0x0962, 0x05cd, 0x0b7d, 0x131a, 0x08c5,
+    0x0951, 0x131c, 0x131b, 0x0f9e, 0x131d, 0x131f, 0x131e, 0x1320,
+    0x1321, 0x0897, 0x0640, 0x1322, 0x1324, 0x1323, 0x1326, 0x0db9,
+    0x1327, 0x05b3, 0x099d, 0x085c, 0x0cee, 0x1328, 0x1329, 0x132b,
+    0x132c, 0x09a2, 0x080f, 0x0fd6, 0x132a, 0x132d, 0x097f, 0x0902,
+    0x1331, 0x0963, 0x0cd2, 0x132e, 0x0d58, 0x1332, 0x0b82, 0x1330,
+    0x1333, 0x085e, 0x1334, 0x1335, 0x0903, 0x06df, 0x1337, 0x1338,
+    0x1339, 0x1336, 0x132f, 0x133a, 0x133b, 0x1004, 0x0b29, 0x133d,
+    0x133e, 0x133c, 0x1340, 0x0e57, 0x05e6, 0x0f35, 0x1341, 0x0b3b,
+    0x0a37, 0x0e7c, 0x076e, 0x09a9, 0x0ff8, 0x0df0, 0x0898, 0x0c8d,
+    0x133f, 0x1342, 0x0c82, 0x1343, 0x1344, 0x1346, 0x0d67, 0x072c,
+    0x1f1f, 0x0641, 0x0fb1, 0x0b2a, 0x0da7, 0x09a4, 0x134c, 0x0f7b,
+    0x111b, 0x06b2, 0x1348, 0x0c19, 0x134b, 0x0dc3, 0x0da8, 0x0dc4,
+    0x0eb7, 0x0d4b, 0x0987, 0x1347, 0x0656, 0x0d95, 0x1349, 0x1345,
+    0x0b6f, 0x134d, 0x0aad, 0x07eb, 0x134e, 0x0fa6, 0x0c5d, 0x0d44,
+    0x1350, 0x0fee, 0x1351, 0x1356, 0x0f6d, 0x1355, 0x134f, 0x1352,
+    0x1354, 0x0964, 0x0f87, 0x1357, 0x0ce4, 0x06b3, 0x0b2b, 0x1359,
+    0x1358, 0x0948, 0x135a, 0x135c, 0x135b, 0x135e, 0x1353, 0x1360,
+    0x135f, 0x135d, 0x09ed, 0x0b70, 0x0c33, 0x1361, 0x0bba, 0x05eb,
+    0x0e84, 0x0d59, 0x1363, 0x1362, 0x1364, 0x1365, 0x1366, 0x1367,
+    0x0f8f, 0x1368, 0x0684, 0x1369, 0x109b, 0x06cf, 0x1287, 0x0aa7,
+    0x0c7d, 0x136a, 0x1069, 0x1032, 0x136c, 0x0ca5, 0x0d96, 0x0c7e,
+    0x0f36, 0x136d, 0x136e, 0x065b, 0x0a38, 0x136f, 0x05ce, 0x1370,
+    0x1371, 0x0642, 0x076f, 0x0e1e, 0x0fb2, 0x1375, 0x0c34, 0x1374,
+    0x085f, 0x0ffa, 0x1373, 0x0dc5, 0x1377, 0x1376, 0x1379, 0x1378,
+    0x065c, 0x137a, 0x0ae7, 0x137c, 0x0cc4, 0x137b, 0x0f71, 0x0ad7,
+    0x0dba, 0x1380, 0x0904, 0x1381, 0x0e40, 0x0edc, 0x104f, 0x0e44,
+    0x138a, 0x0797, 0x10a4, 0x102d, 0x13ea, 0x1382, 0x1385, 0x0c83,
+    0x0fd7, 0x0da9, 0x1386, 0x1005, 0x0988, 0x0ae8, 0x1387, 0x09ef,
+    0x09ee, 0x05b7, 0x08c6, 0x0ba9, 0x05cf, 0x138b, 0x138c, 0x1389,
+    0x0617, 0x072d, 0x1388, 0x1043, 0x0f10, 0x05a6, 0x05f7, 0x09f0,
+    0x05d0, 0x05a1, 0x1391, 0x138f, 0x103a, 0x1392, 0x1390, 0x138e,
+    0x0b50, 0x138d, 0x0f98, 0x08e2, 0x1396, 0x1397, 0x0ae9, 0x1393,
+    0x114b, 0x0e6b, 0x1395, 0x0965, 0x1398, 0x0f37, 0x1399, 0x1394,
+    0x1039, 0x0e7d, 0x139a, 0x0f11, 0x139b, 0x139f, 0x139c, 0x0685,
+    0x139e, 0x0a39, 0x139d, 0x0899, 0x13ab, 0x13a4, 0x13a1, 0x0d04,
+    0x13a0, 0x13a2, 0x13a3, 0x13a5, 0x13a6, 0x0770, 0x13a8, 0x13a7,
+    0x13a9, 0x0b2c, 0x13ac, 0x0d5a, 0x0624, 0x13aa, 0x13ad, 0x13ae,
+    0x13b1, 0x13af, 0x13b0, 0x09f1, 0x13b2, 0x0905, 0x13b3, 0x0a1a,
+    0x0c76, 0x13b4, 0x13b5, 0x09f9, 0x0906, 0x1050, 0x0787, 0x08c7,
+    0x13b6, 0x06f7, 0x13b7, 0x0c77, 0x13b8, 0x13e1, 0x13b9, 0x13ba,
+    0x13bb, 0x13bd, 0x13be, 0x13c0, 0x0cae, 0x0606, 0x0a67, 0x05c0,
+    0x0c36, 0x072e, 0x0a33, 0x0907, 0x0dc6, 0x0a80, 0x072f, 0x0d08,
+    0x0d68, 0x05b6, 0x0798, 0x0fb3, 0x0a40, 0x07b1, 0x0be9, 0x0a3a,
+    0x1087, 0x13c1, 0x07bb, 0x0989, 0x06d1, 0x0643, 0x0aea, 0x0686,
+    0x13c2, 0x10a5, 0x0aa8, 0x0a62, 0x13c3, 0x0771, 0x0e10, 0x1027,
+    0x13c4, 0x13c5, 0x0f38, 0x13c7, 0x0726, 0x0835, 0x13c6, 0x0730,
+    0x0b51, 0x13cb, 0x09c0, 0x0687, 0x13ca, 0x13c8, 0x13cc, 0x13c9,
+    0x0e4a, 0x164b, 0x0b52, 0x13cd, 0x10fe, 0x13ce, 0x13d0, 0x0d1e,
+    0x13cf, 0x0ba1, 0x0a1b, 0x0c8e, 0x0a75, 0x0f55, 0x0bea, 0x0a4b,
+    0x13d1, 0x0aeb, 0x13d2, 0x13d3, 0x05d1, 0x0c78, 0x0b71, 0x13d4,
+    0x0df1, 0x0aec, 0x0aed, 0x13d5, 0x0beb, 0x0aee, 0x13d6, 0x13d7,
+    0x105e, 0x13d8, 0x0804, 0x0a81, 0x13d9, 0x13da, 0x0a5a, 0x0b4b,
+    0x0e32, 0x0b73, 0x0ef6, 0x0e41, 0x0807, 0x13db, 0x07cf, 0x13dc,
+    0x083c, 0x0e0d, 0x066e, 0x09f2, 0x13dd, 0x13e0, 0x13df, 0x083b,
+    0x13de, 0x0d97, 0x0c6e, 0x0daa, 0x0a46, 0x0c37, 0x10da, 0x13e2,
+    0x13e3, 0x0e14, 0x09d2, 0x13e5, 0x13e6, 0x13e7, 0x0772, 0x13e8,
+    0x13e9, 0x066a, 0x0c1a, 0x0762, 0x13eb, 0x1026, 0x0c90, 0x06f8,
+    0x13ed, 0x13ef, 0x075d, 0x13ec, 0x13ee, 0x13f1, 0x13f0, 0x13f2,
+    0x13f3, 0x0dfb, 0x07ec, 0x06a3, 0x13f4, 0x13f9, 0x13f7, 0x0fb5,
+    0x0fb4, 0x0dc7, 0x13f6, 0x0ab3, 0x13f5, 0x0b92, 0x13fa, 0x09a8,
+    0x1400, 0x1401, 0x13fb, 0x06d2, 0x13fc, 0x1405, 0x1404, 0x1403,
+    0x13ff, 0x13fe, 0x1402, 0x0fb6, 0x1409, 0x1406, 0x1408, 0x10d2,
+    0x1407, 0x13fd, 0x0b93, 0x140a, 0x0975, 0x140b, 0x140c, 0x140f,
+    0x140e, 0x140d, 0x0dc8, 0x13f8, 0x1415, 0x1411, 0x1410, 0x1412,
+    0x1413, 0x1416, 0x1124, 0x1417, 0x1414, 0x1418, 0x075e, 0x1419,
+    0x141b, 0x141a, 0x141c, 0x141d, 0x0bec, 0x0a82, 0x0ac4, 0x0c43,
+    0x0908, 0x0976, 0x0909, 0x07d0, 0x141e, 0x0977, 0x08c8, 0x141f,
+    0x1024, 0x0e62, 0x1420, 0x090a, 0x072a, 0x0cc6, 0x0810, 0x09f3,
+    0x0f3a, 0x0ebf, 0x1421, 0x0773, 0x1424, 0x0d1f, 0x1423, 0x1422,
+    0x1425, 0x0d69, 0x0b83, 0x09f4, 0x0bc8, 0x0c91, 0x0781, 0x0d20,
+    0x1426, 0x1427, 0x0b2d, 0x0fd8, 0x142a, 0x1429, 0x1428, 0x0f5d,
+    0x1431, 0x0ff9, 0x142b, 0x142d, 0x100b, 0x142c, 0x142e, 0x0ea6,
+    0x142f, 0x0f7c, 0x1430, 0x0731, 0x0f7d, 0x0e4e, 0x1432, 0x1433,
+    0x090b, 0x0732, 0x1434, 0x08b6, 0x10a3, 0x1088, 0x0774, 0x1436,
+    0x0d21, 0x090c, 0x0aef, 0x0edd, 0x0af0, 0x0ad8, 0x0d6a, 0x0fb7,
+    0x0d98, 0x090d, 0x0f3b, 0x1437, 0x0db8, 0x0980, 0x08c9, 0x0d6b,
+    0x05c1, 0x0ace, 0x090e, 0x10a6, 0x1438, 0x1439, 0x0e70, 0x143a,
+    0x1135, 0x114c, 0x143c, 0x143b, 0x06e6, 0x1440, 0x1443, 0x1444,
+    0x1442, 0x0f1f, 0x0af1, 0x1446, 0x1445, 0x1441, 0x1447, 0x1448,
+    0x1449, 0x144c, 0x144a, 0x144b, 0x144d, 0x0644, 0x0d6c, 0x144e,
+    0x089a, 0x06b4, 0x0e55, 0x144f, 0x0e39, 0x0f99, 0x1450, 0x114d,
+    0x1451, 0x0f7e, 0x1454, 0x119f, 0x11af, 0x0a2e, 0x0e33, 0x1455,
+    0x07bc, 0x0d22, 0x05f8, 0x1456, 0x0f64, 0x090f, 0x0cef, 0x0d6d,
+    0x106d, 0x08b7, 0x08ca, 0x1457, 0x1458, 0x145e, 0x0a63, 0x0d23,
+    0x07ed, 0x1459, 0x0f0a, 0x0ce5, 0x145a, 0x145b, 0x07ee, 0x145c,
+    0x145d, 0x145f, 0x0dd6, 0x1460, 0x1461, 0x1462, 0x1453, 0x1452,
+    0x1463, 0x0860, 0x0f06, 0x098a, 0x0f16, 0x0d24, 0x0f2a, 0x1464,
+    0x0af2, 0x0625, 0x1465, 0x1466, 0x1070, 0x0ede, 0x1469, 0x065d,
+    0x0baa, 0x1468, 0x1467, 0x0861, 0x0c92, 0x146d, 0x146b, 0x146a,
+    0x10e5, 0x08e3, 0x0ad9, 0x146c, 0x0dab, 0x0a9d, 0x0dfe, 0x1470,
+    0x146f, 0x146e, 0x1471, 0x08e4, 0x1472, 0x0f5c, 0x0aba, 0x1473,
+    0x0ef7, 0x0dff, 0x0d25, 0x0d8f, 0x1474, 0x078a, 0x0b53, 0x0f0b,
+    0x0775, 0x0e45, 0x1475, 0x09f5, 0x0fd9, 0x0fda, 0x065e, 0x147a,
+    0x0d09, 0x1477, 0x06b5, 0x14ab, 0x1479, 0x0e4f, 0x1478, 0x1476,
+    0x095a, 0x147c, 0x1483, 0x1489, 0x1481, 0x0dbb, 0x1486, 0x0f3c,
+    0x1480, 0x1485, 0x1125, 0x09f6, 0x0c93, 0x147d, 0x07bd, 0x1488,
+    0x0bab, 0x0645, 0x1482, 0x06b6, 0x1487, 0x07ef, 0x1484, 0x148a,
+    0x148c, 0x1496, 0x1494, 0x1491, 0x1490, 0x1136, 0x1492, 0x07f0,
+    0x0910, 0x0ada, 0x1499, 0x148b, 0x148f, 0x147e, 0x06b8, 0x1493,
+    0x1495, 0x0cf0, 0x0966, 0x0676, 0x148d, 0x1498, 0x1497, 0x07f1,
+    0x0c67, 0x0706, 0x0862, 0x148e, 0x149a, 0x149d, 0x149f, 0x0a3b,
+    0x14a5, 0x0d6e, 0x149b, 0x14a3, 0x06b7, 0x14a1, 0x14a2, 0x149e,
+    0x14a0, 0x08e5, 0x1089, 0x0733, 0x0638, 0x14a4, 0x0e59, 0x05ab,
+    0x0edf, 0x147b, 0x14aa, 0x14ae, 0x1063, 0x14a7, 0x0dc9, 0x14ac,
+    0x0b2e, 0x14ad, 0x0e15, 0x1166, 0x14a9, 0x14af, 0x095b, 0x0bc9,
+    0x05d2, 0x14a8, 0x14a6, 0x0c39, 0x149c, 0x09d3, 0x0c84, 0x14bb,
+    0x0c3a, 0x14b6, 0x14b3, 0x14b4, 0x0a64, 0x14b7, 0x14ba, 0x14b5,
+    0x0a84, 0x14b8, 0x14b2, 0x107a, 0x1079, 0x14bc, 0x14bd, 0x05d3,
+    0x14b1, 0x0830, 0x05a4, 0x0734, 0x14b9, 0x14c1, 0x14c0, 0x14c5,
+    0x14c6, 0x14c4, 0x14c7, 0x14bf, 0x14c3, 0x14c8, 0x14c9, 0x14be,
+    0x0a1c, 0x14c2, 0x0c94, 0x0911, 0x14b0, 0x0b54, 0x14d6, 0x0fa7,
+    0x14cc, 0x14cd, 0x14ce, 0x14d5, 0x14d4, 0x101d, 0x0735, 0x14d2,
+    0x0864, 0x06d3, 0x14cf, 0x10f6, 0x14d1, 0x05d4, 0x14d3, 0x14ca,
+    0x14d0, 0x14d7, 0x0863, 0x14cb, 0x10bc, 0x108a, 0x14da, 0x14de,
+    0x0c5e, 0x1137, 0x14df, 0x14dc, 0x14d9, 0x14d8, 0x14dd, 0x0f6e,
+    0x0df2, 0x0865, 0x14e0, 0x14db, 0x14e1, 0x089b, 0x066f, 0x14e9,
+    0x0736, 0x14e7, 0x14e8, 0x0967, 0x14e6, 0x14e4, 0x14e3, 0x14ea,
+    0x14e2, 0x14ec, 0x06b9, 0x14ee, 0x14ed, 0x0d26, 0x14f1, 0x14ef,
+    0x14e5, 0x089c, 0x14f0, 0x14f4, 0x14f3, 0x14f5, 0x14f2, 0x14f6,
+    0x14f7, 0x14f8, 0x0fa8, 0x14fa, 0x14f9, 0x0a9e, 0x0bac, 0x06a4,
+    0x06ba, 0x14fb, 0x05bd, 0x0bca, 0x14fc, 0x1c41, 0x1500, 0x0881,
+    0x1501, 0x0bed, 0x1502, 0x1503, 0x0799, 0x1504, 0x1505, 0x1506,
+    0x0c95, 0x08cb, 0x105f, 0x0fdb, 0x0aca, 0x1507, 0x0bee, 0x1cfb,
+    0x0ee0, 0x0a68, 0x098b, 0x1508, 0x0c85, 0x0f65, 0x0caf, 0x150b,
+    0x1509, 0x150c, 0x150a, 0x150d, 0x0f6f, 0x05b5, 0x0f3d, 0x0ee1,
+    0x150e, 0x1511, 0x0af3, 0x079a, 0x150f, 0x1516, 0x0af4, 0x1510,
+    0x0e63, 0x10bd, 0x1512, 0x1513, 0x1517, 0x0dca, 0x1514, 0x0912,
+    0x0bdc, 0x1525, 0x0eb2, 0x0cb0, 0x0ee2, 0x156b, 0x0fb8, 0x0d6f,
+    0x1015, 0x151a, 0x065f, 0x0d0a, 0x1523, 0x0cd3, 0x151d, 0x1524,
+    0x151f, 0x1526, 0x1522, 0x1521, 0x0e8f, 0x151b, 0x06bb, 0x1519,
+    0x07d1, 0x0cb1, 0x1515, 0x1518, 0x0913, 0x0bd9, 0x0af5, 0x1520,
+    0x0e71, 0x07d2, 0x06e7, 0x0707, 0x0b40, 0x1528, 0x152d, 0x1529,
+    0x089d, 0x152e, 0x09c1, 0x0949, 0x0a85, 0x151c, 0x0a1d, 0x152b,
+    0x09f7, 0x152c, 0x05c2, 0x1527, 0x0d27, 0x07d3, 0x07f2, 0x152a,
+    0x05a5, 0x0981, 0x0b55, 0x0d70, 0x0ed2, 0x1530, 0x0c3d, 0x0c68,
+    0x09ca, 0x1531, 0x1533, 0x152f, 0x0f9f, 0x0d3b, 0x0c3b, 0x0fb9,
+    0x0a4c, 0x1540, 0x153e, 0x0b98, 0x089e, 0x1538, 0x0af7, 0x0e26,
+    0x0e50, 0x1536, 0x0c3c, 0x0a76, 0x153b, 0x0af6, 0x1535, 0x153a,
+    0x0e72, 0x1534, 0x0840, 0x06fc, 0x153c, 0x10e9, 0x098c, 0x0cd4,
+    0x1539, 0x0bda, 0x0914, 0x0b84, 0x0646, 0x0c1b, 0x1537, 0x07a4,
+    0x0866, 0x0d4d, 0x153d, 0x0c3e, 0x1541, 0x1543, 0x0c75, 0x1549,
+    0x1544, 0x1546, 0x0f20, 0x0d71, 0x1547, 0x108b, 0x10a7, 0x0737,
+    0x05ac, 0x1545, 0x1542, 0x0776, 0x0647, 0x1548, 0x10a8, 0x154c,
+    0x0c79, 0x1553, 0x154d, 0x154a, 0x1551, 0x1532, 0x154e, 0x1552,
+    0x0ec0, 0x0dcb, 0x154b, 0x154f, 0x0867, 0x09af, 0x0bdb, 0x1557,
+    0x0d85, 0x1554, 0x1000, 0x1555, 0x1556, 0x104c, 0x0ba0, 0x0882,
+    0x155d, 0x09d4, 0x155a, 0x1559, 0x0e51, 0x0df3, 0x0d90, 0x155b,
+    0x155c, 0x0f4f, 0x0e64, 0x09c2, 0x0bef, 0x0fef, 0x06e8, 0x1563,
+    0x155e, 0x10a9, 0x1565, 0x1561, 0x1562, 0x0c40, 0x1560, 0x151e,
+    0x1564, 0x155f, 0x1569, 0x156a, 0x0d86, 0x156c, 0x09c3, 0x1567,
+    0x079b, 0x156d, 0x1566, 0x1571, 0x1570, 0x156f, 0x1572, 0x1574,
+    0x0b2f, 0x1573, 0x1577, 0x1575, 0x1576, 0x1550, 0x1579, 0x1578,
+    0x1558, 0x157a, 0x156e, 0x09f8, 0x157b, 0x157c, 0x157e, 0x157d,
+    0x157f, 0x06bc, 0x0915, 0x0fba, 0x0bad, 0x08cc, 0x1581, 0x1584,
+    0x0f31, 0x07be, 0x1583, 0x1582, 0x0e73, 0x1585, 0x07f3, 0x1587,
+    0x1586, 0x0738, 0x09d5, 0x0e16, 0x0868, 0x0b94, 0x1588, 0x0bae,
+    0x0d87, 0x0f3e, 0x1589, 0x158a, 0x158b, 0x0f76, 0x13bc, 0x0bc4,
+    0x0f2b, 0x0996, 0x0ee3, 0x0ec1, 0x0dac, 0x10ff, 0x158d, 0x0a4e,
+    0x158e, 0x05b4, 0x0812, 0x0bcb, 0x0f40, 0x158f, 0x09e1, 0x0ce6,
+    0x09fa, 0x0b56, 0x1590, 0x0fbb, 0x0657, 0x09fb, 0x1593, 0x1591,
+    0x1594, 0x10f7, 0x1592, 0x0bf9, 0x1595, 0x0c70, 0x1596, 0x0778,
+    0x1598, 0x1597, 0x1599, 0x159a, 0x0779, 0x0e3a, 0x0cd5, 0x07cc,
+    0x09fc, 0x0c41, 0x0abb, 0x05ae, 0x159b, 0x0660, 0x159f, 0x0916,
+    0x159e, 0x0969, 0x0af8, 0x159d, 0x0af9, 0x103e, 0x0968, 0x05d5,
+    0x0bcc, 0x15a4, 0x0baf, 0x0626, 0x0ab4, 0x1006, 0x09b0, 0x0afa,
+    0x0ba5, 0x15a3, 0x15a1, 0x15a2, 0x0d0b, 0x15c5, 0x15a8, 0x0a1e,
+    0x0917, 0x15a6, 0x15a7, 0x0b57, 0x15a5, 0x09ce, 0x15aa, 0x15a9,
+    0x15ae, 0x15af, 0x15ab, 0x06c1, 0x15ac, 0x15ad, 0x0ed3, 0x0f41,
+    0x0869, 0x15b0, 0x0bb0, 0x0afb, 0x0cf1, 0x0805, 0x15b1, 0x15b5,
+    0x0689, 0x15b2, 0x15b4, 0x15b3, 0x0acb, 0x0ce7, 0x05c3, 0x15b6,
+    0x15b7, 0x0d28, 0x112f, 0x09e2, 0x0fa9, 0x0fdc, 0x15c1, 0x15b9,
+    0x15bc, 0x15bb, 0x15b8, 0x15c0, 0x0e1c, 0x15ba, 0x15c2, 0x0acc,
+    0x15c3, 0x10aa, 0x0e98, 0x15c4, 0x15c6, 0x15c7, 0x15c8, 0x0808,
+    0x0627, 0x0918, 0x15c9, 0x15ca, 0x0ad1, 0x0c42, 0x1296, 0x0c1d,
+    0x0c1c, 0x0c96, 0x0985, 0x11f0, 0x088e, 0x108c, 0x0fbc, 0x0f5e,
+    0x15cb, 0x09b1, 0x0d3d, 0x15cc, 0x114e, 0x0fdd, 0x0d29, 0x15cd,
+    0x077a, 0x15ce, 0x15cf, 0x1058, 0x1022, 0x1016, 0x0ffb, 0x09c4,
+    0x15d1, 0x0a69, 0x0ff0, 0x15d3, 0x15d6, 0x15d5, 0x0777, 0x07c0,
+    0x15d2, 0x15d4, 0x15d7, 0x0b99, 0x10db, 0x05c7, 0x099e, 0x0c7a,
+    0x0a5b, 0x0b31, 0x15da, 0x0dad, 0x15d8, 0x0c69, 0x15d9, 0x0b30,
+    0x105b, 0x15db, 0x15dc, 0x10c8, 0x15e1, 0x0919, 0x0e74, 0x15de,
+    0x0dcc, 0x159c, 0x15a0, 0x07ae, 0x0e66, 0x15e0, 0x0afc, 0x0ec2,
+    0x15e6, 0x0ef8, 0x15dd, 0x15e3, 0x15e2, 0x0bcd, 0x100d, 0x1111,
+    0x1007, 0x068a, 0x09fd, 0x1167, 0x15e5, 0x0b95, 0x15e4, 0x15df,
+    0x08cd, 0x15eb, 0x15e9, 0x068b, 0x15e7, 0x15ed, 0x15f3, 0x0c86,
+    0x0f7f, 0x15f5, 0x0f01, 0x15f4, 0x0e90, 0x0fde, 0x0739, 0x0bf5,
+    0x0a9f, 0x0d51, 0x108d, 0x15f0, 0x15ef, 0x15f1, 0x15ee, 0x15f6,
+    0x15ec, 0x15ea, 0x15f2, 0x15e8, 0x0d0c, 0x1076, 0x0a44, 0x09b2,
+    0x0978, 0x100f, 0x06e0, 0x0d4c, 0x0e08, 0x0628, 0x0bf0, 0x0bb2,
+    0x0849, 0x15f8, 0x091a, 0x071c, 0x15fa, 0x0714, 0x1601, 0x15fd,
+    0x0bf1, 0x06ea, 0x096a, 0x06e9, 0x098d, 0x15fb, 0x0885, 0x086a,
+    0x0dcd, 0x15f9, 0x05c4, 0x15fc, 0x15fe, 0x080b, 0x084b, 0x073a,
+    0x07aa, 0x1602, 0x09b7, 0x1011, 0x09d6, 0x1603, 0x0f0f, 0x160f,
+    0x0671, 0x1604, 0x1615, 0x1605, 0x1100, 0x160c, 0x0e7e, 0x1614,
+    0x1607, 0x05b2, 0x1609, 0x091b, 0x160b, 0x160a, 0x1606, 0x1611,
+    0x0afd, 0x136b, 0x08e6, 0x10dc, 0x1608, 0x0d72, 0x06c2, 0x096b,
+    0x1600, 0x1610, 0x0701, 0x160e, 0x1612, 0x0dce, 0x077c, 0x1630,
+    0x1047, 0x1617, 0x077b, 0x161e, 0x0fdf, 0x161f, 0x1621, 0x1625,
+    0x1619, 0x0cc9, 0x0dcf, 0x1629, 0x161c, 0x1626, 0x1620, 0x0b58,
+    0x162a, 0x0bb1, 0x1628, 0x073b, 0x116f, 0x1616, 0x1624, 0x05d6,
+    0x1618, 0x1038, 0x161d, 0x0b41, 0x0d45, 0x1613, 0x1623, 0x0b9a,
+    0x162d, 0x0711, 0x089f, 0x162f, 0x161a, 0x162e, 0x1627, 0x161b,
+    0x162b, 0x162c, 0x163d, 0x0e0c, 0x1622, 0x1639, 0x163b, 0x0d56,
+    0x10ab, 0x0f56, 0x1636, 0x0c88, 0x163c, 0x0c1e, 0x1633, 0x1640,
+    0x163f, 0x0e2d, 0x163e, 0x0e28, 0x1642, 0x1635, 0x0806, 0x1638,
+    0x0abc, 0x0e80, 0x163a, 0x0809, 0x1632, 0x1634, 0x1631, 0x114f,
+    0x06f9, 0x1637, 0x1641, 0x06d4, 0x09a5, 0x063c, 0x1652, 0x1150,
+    0x1655, 0x0b59, 0x1654, 0x1653, 0x1650, 0x1644, 0x1661, 0x1643,
+    0x1656, 0x164e, 0x1649, 0x1646, 0x1647, 0x164f, 0x1f20, 0x164c,
+    0x091c, 0x0d46, 0x0c44, 0x164a, 0x1645, 0x1648, 0x10ac, 0x100a,
+    0x164d, 0x1657, 0x165f, 0x1658, 0x1665, 0x1663, 0x165e, 0x165d,
+    0x0d4e, 0x0c45, 0x165b, 0x1659, 0x1660, 0x1666, 0x0ef3, 0x166c,
+    0x1667, 0x166a, 0x1664, 0x0d14, 0x0f17, 0x165a, 0x1662, 0x0afe,
+    0x104d, 0x1676, 0x1669, 0x08a0, 0x0661, 0x06fe, 0x1651, 0x0aff,
+    0x166e, 0x1675, 0x0a77, 0x0712, 0x0ccd, 0x166b, 0x1670, 0x1674,
+    0x07f4, 0x07ab, 0x1672, 0x0780, 0x0e09, 0x1671, 0x1673, 0x166d,
+    0x166f, 0x0700, 0x0ce8, 0x167a, 0x1678, 0x08e7, 0x1677, 0x1680,
+    0x15f7, 0x1679, 0x167b, 0x167c, 0x168b, 0x1687, 0x160d, 0x1686,
+    0x1685, 0x1682, 0x1668, 0x1684, 0x1683, 0x1689, 0x1145, 0x168c,
+    0x0839, 0x1688, 0x168a, 0x0ea5, 0x168d, 0x1691, 0x168e, 0x10d3,
+    0x168f, 0x165c, 0x1692, 0x1693, 0x0614, 0x1695, 0x0887, 0x0a1f,
+    0x0813, 0x0662, 0x10be, 0x1697, 0x1696, 0x1699, 0x079c, 0x0814,
+    0x073c, 0x169c, 0x169b, 0x169d, 0x068c, 0x0cd6, 0x169e, 0x073d,
+    0x16a0, 0x169f, 0x16a1, 0x16a2, 0x16a3, 0x09fe, 0x0bb3, 0x095f,
+    0x0f50, 0x0fa0, 0x1163, 0x0a15, 0x098e, 0x1130, 0x16a4, 0x16a5,
+    0x0a00, 0x16a6, 0x16a7, 0x16a9, 0x16a8, 0x0ff7, 0x0abd, 0x0a6a,
+    0x09e3, 0x16aa, 0x16ac, 0x0b42, 0x16ab, 0x16ad, 0x16ae, 0x16af,
+    0x16b0, 0x16b1, 0x16b3, 0x16b2, 0x16b4, 0x0663, 0x0ce9, 0x16b5,
+    0x09c5, 0x06eb, 0x16b6, 0x0da1, 0x134a, 0x0782, 0x16b7, 0x16b8,
+    0x0faa, 0x1008, 0x0e05, 0x16b9, 0x0ee4, 0x0ef9, 0x1051, 0x16ba,
+    0x16bc, 0x16bb, 0x16be, 0x16bd, 0x16c1, 0x0a01, 0x102f, 0x16c2,
+    0x16c3, 0x0783, 0x16c4, 0x16c6, 0x16c5, 0x0b85, 0x0f18, 0x0629,
+    0x0ec3, 0x0d73, 0x0aa0, 0x07c1, 0x0ec4, 0x0a2c, 0x16c8, 0x073e,
+    0x0658, 0x0e30, 0x16c7, 0x091d, 0x0cf2, 0x16c9, 0x16d1, 0x16ca,
+    0x0c7f, 0x07c2, 0x16d2, 0x0888, 0x0784, 0x16d0, 0x16ce, 0x16cb,
+    0x10c0, 0x0d3e, 0x0e17, 0x16cc, 0x16d4, 0x16d3, 0x0842, 0x066b,
+    0x0979, 0x16cd, 0x16cf, 0x0ff6, 0x0cb2, 0x1017, 0x16dc, 0x16dd,
+    0x068d, 0x0f66, 0x107b, 0x16df, 0x0a21, 0x0b00, 0x16d8, 0x16de,
+    0x0648, 0x07f5, 0x16d5, 0x16da, 0x0bf2, 0x0e91, 0x0ee5, 0x16d7,
+    0x0fc0, 0x16d9, 0x16e2, 0x16e0, 0x16db, 0x0fc1, 0x0e67, 0x07c3,
+    0x0d84, 0x0d0d, 0x16e3, 0x16e1, 0x0c97, 0x16d6, 0x062a, 0x10ad,
+    0x16ee, 0x16ed, 0x0bf4, 0x16ea, 0x10cc, 0x0df4, 0x16e4, 0x0d43,
+    0x062b, 0x091e, 0x16e7, 0x0a86, 0x16ec, 0x16eb, 0x16e6, 0x16e9,
+    0x0708, 0x16e8, 0x0e68, 0x10ec, 0x0b32, 0x0bf3, 0x16f4, 0x16f2,
+    0x0f2c, 0x16ef, 0x16f1, 0x0619, 0x091f, 0x1151, 0x06dc, 0x0f42,
+    0x10c1, 0x06c3, 0x0b5a, 0x16f3, 0x16f8, 0x0b01, 0x108f, 0x16f5,
+    0x16f0, 0x16f6, 0x111c, 0x0dd3, 0x0e00, 0x06d5, 0x0634, 0x16fc,
+    0x16ff, 0x1101, 0x10c4, 0x1706, 0x1700, 0x16fd, 0x1112, 0x1703,
+    0x0aa9, 0x1705, 0x170a, 0x0dd1, 0x1708, 0x1702, 0x0cd7, 0x1709,
+    0x16fe, 0x1704, 0x170b, 0x05fa, 0x1701, 0x170c, 0x0b5b, 0x0abe,
+    0x0f63, 0x096c, 0x16f9, 0x1707, 0x0d99, 0x0bb4, 0x0709, 0x098f,
+    0x0b02, 0x16fb, 0x0aa1, 0x086b, 0x16fa, 0x1710, 0x0acd, 0x08b8,
+    0x171f, 0x1719, 0x07d4, 0x0dae, 0x1714, 0x171d, 0x05ad, 0x0611,
+    0x0677, 0x1716, 0x0c6a, 0x170d, 0x170f, 0x0920, 0x1720, 0x171b,
+    0x1713, 0x171a, 0x1029, 0x1718, 0x171c, 0x08ce, 0x0b03, 0x0cd8,
+    0x1712, 0x108e, 0x1715, 0x170e, 0x0dd2, 0x1711, 0x1717, 0x1170,
+    0x0a3c, 0x101e, 0x1721, 0x0eac, 0x172d, 0x08b9, 0x0ac0, 0x1723,
+    0x10ed, 0x0921, 0x1730, 0x05ec, 0x172e, 0x1722, 0x1728, 0x172a,
+    0x10ae, 0x1725, 0x0d8d, 0x1727, 0x172f, 0x1729, 0x1045, 0x1724,
+    0x0a20, 0x173c, 0x070a, 0x1726, 0x172b, 0x172c, 0x0caa, 0x0c98,
+    0x1734, 0x173a, 0x1738, 0x0d88, 0x1742, 0x1735, 0x1736, 0x171e,
+    0x07d9, 0x0f19, 0x0a3d, 0x0957, 0x1152, 0x1732, 0x1741, 0x0649,
+    0x0c46, 0x0e99, 0x073f, 0x1138, 0x101f, 0x0d50, 0x1739, 0x173b,
+    0x0c11, 0x1740, 0x1737, 0x1731, 0x0741, 0x0889, 0x174e, 0x1749,
+    0x0bf6, 0x0703, 0x0ac1, 0x1752, 0x174b, 0x0d2a, 0x1748, 0x0d57,
+    0x176b, 0x1745, 0x1744, 0x174d, 0x1747, 0x1746, 0x174c, 0x0b9f,
+    0x1743, 0x174f, 0x1750, 0x0740, 0x1755, 0x1754, 0x1756, 0x1759,
+    0x0da2, 0x1753, 0x1757, 0x0883, 0x0cb7, 0x1751, 0x0e5a, 0x1758,
+    0x175d, 0x175b, 0x175e, 0x1761, 0x175a, 0x094a, 0x0e47, 0x16f7,
+    0x10d4, 0x175c, 0x1760, 0x0cb3, 0x175f, 0x174a, 0x1d89, 0x1764,
+    0x1768, 0x1766, 0x1762, 0x1763, 0x1767, 0x1765, 0x0f2d, 0x176d,
+    0x176a, 0x1769, 0x176c, 0x0e12, 0x176e, 0x0d15, 0x0cab, 0x0ba3,
+    0x176f, 0x1771, 0x1770, 0x1733, 0x1772, 0x0e25, 0x1773, 0x068e,
+    0x0dd4, 0x06c4, 0x07c4, 0x0a5c, 0x0990, 0x1146, 0x0b86, 0x064a,
+    0x1775, 0x1774, 0x1778, 0x0cd9, 0x177b, 0x1776, 0x177a, 0x1779,
+    0x0d9f, 0x05d7, 0x1133, 0x177d, 0x0607, 0x1780, 0x177e, 0x177c,
+    0x1777, 0x0fc2, 0x1782, 0x1781, 0x064b, 0x1784, 0x0f70, 0x1783,
+    0x1033, 0x0b05, 0x0c12, 0x0b04, 0x1139, 0x178a, 0x0bf7, 0x1786,
+    0x178b, 0x064c, 0x1789, 0x0e81, 0x1785, 0x1788, 0x0b06, 0x0ecf,
+    0x178c, 0x0a4f, 0x0bf8, 0x178f, 0x1787, 0x0846, 0x178d, 0x10af,
+    0x1790, 0x1f24, 0x0aae, 0x1791, 0x1792, 0x0e4d, 0x1794, 0x1795,
+    0x0e52, 0x0dd5, 0x1797, 0x1799, 0x1113, 0x1796, 0x1798, 0x064d,
+    0x1793, 0x12fa, 0x179a, 0x0c47, 0x09d7, 0x179c, 0x179b, 0x0b43,
+    0x1297, 0x179d, 0x179f, 0x178e, 0x179e, 0x17a0, 0x0e9a, 0x17a1,
+    0x17a2, 0x17a3, 0x17a4, 0x0d5c, 0x17a6, 0x17a5, 0x17a7, 0x17a8,
+    0x0a5d, 0x0f43, 0x106a, 0x17a9, 0x17aa, 0x0c35, 0x0a22, 0x17ab,
+    0x17ac, 0x17ad, 0x0f90, 0x0ec5, 0x17ae, 0x0e76, 0x0d2b, 0x17af,
+    0x06a5, 0x07cd, 0x1044, 0x1034, 0x0672, 0x1153, 0x0ff1, 0x0f68,
+    0x0bb5, 0x17b0, 0x0e01, 0x08a1, 0x17b1, 0x0992, 0x17b3, 0x17b2,
+    0x17b4, 0x17b5, 0x17b6, 0x079d, 0x17b7, 0x17b8, 0x08a2, 0x0ec6,
+    0x17ba, 0x0b33, 0x17b9, 0x07f6, 0x17bb, 0x17bd, 0x17bc, 0x17be,
+    0x08cf, 0x17bf, 0x0827, 0x0c1f, 0x095d, 0x17c1, 0x17c2, 0x17c0,
+    0x0a6b, 0x0e06, 0x07f7, 0x17c4, 0x0ccb, 0x17c3, 0x1154, 0x0e82,
+    0x17c7, 0x17c9, 0x17c6, 0x1052, 0x17c8, 0x17ca, 0x1102, 0x17ce,
+    0x17cd, 0x0d16, 0x0e4c, 0x08a3, 0x17cc, 0x17cb, 0x1090, 0x1091,
+    0x17cf, 0x064e, 0x0956, 0x0a02, 0x17d0, 0x17d1, 0x17d3, 0x0aa2,
+    0x17d5, 0x17d4, 0x17d6, 0x06ec, 0x17d8, 0x17d7, 0x17da, 0x17d9,
+    0x08ba, 0x10e6, 0x080a, 0x0664, 0x0828, 0x075f, 0x1126, 0x17dc,
+    0x17de, 0x17df, 0x068f, 0x17db, 0x09d8, 0x0d3f, 0x17dd, 0x17e2,
+    0x0a6c, 0x17e0, 0x085d, 0x0ec7, 0x17e1, 0x17fc, 0x17e7, 0x08bb,
+    0x07c5, 0x17e4, 0x10dd, 0x10ee, 0x0cb4, 0x17e6, 0x17e8, 0x1114,
+    0x0815, 0x0efa, 0x0e69, 0x17e9, 0x17eb, 0x17ee, 0x17ea, 0x17ed,
+    0x08e8, 0x062c, 0x17ef, 0x0b90, 0x17ec, 0x111a, 0x17f2, 0x1f22,
+    0x17f0, 0x17f3, 0x17e5, 0x17f1, 0x097a, 0x17f4, 0x17f5, 0x10de,
+    0x17f6, 0x17f7, 0x17e3, 0x17f8, 0x0742, 0x0a23, 0x17f9, 0x17fa,
+    0x17fb, 0x061a, 0x1800, 0x0f1a, 0x1801, 0x0722, 0x1802, 0x1803,
+    0x1804, 0x1806, 0x1807, 0x1805, 0x0f32, 0x1809, 0x1808, 0x180b,
+    0x180a, 0x180c, 0x180d, 0x180f, 0x180e, 0x0959, 0x1811, 0x1810,
+    0x0743, 0x0b72, 0x0d9b, 0x1812, 0x0bb6, 0x09d9, 0x0659, 0x1813,
+    0x10b0, 0x0fa1, 0x1814, 0x0da3, 0x1092, 0x0922, 0x0b5c, 0x0cea,
+    0x1272, 0x0d2c, 0x06a6, 0x1815, 0x1816, 0x181b, 0x1819, 0x1818,
+    0x1580, 0x06c5, 0x1817, 0x05d8, 0x0ea8, 0x0ec8, 0x10ef, 0x181c,
+    0x181a, 0x0cfb, 0x0ba4, 0x0ea9, 0x0f0c, 0x181e, 0x10ea, 0x086c,
+    0x181f, 0x181d, 0x0ed4, 0x1820, 0x1821, 0x05d9, 0x0b34, 0x1826,
+    0x1823, 0x0e2b, 0x1822, 0x0785, 0x1829, 0x1824, 0x1825, 0x1828,
+    0x1827, 0x0f04, 0x0c21, 0x0c20, 0x079e, 0x182a, 0x182b, 0x182c,
+    0x182e, 0x182d, 0x0635, 0x1836, 0x0ee6, 0x1830, 0x1832, 0x1834,
+    0x0b5d, 0x1835, 0x1833, 0x0a3e, 0x182f, 0x1831, 0x0f21, 0x0b07,
+    0x1838, 0x1837, 0x1839, 0x0a24, 0x096d, 0x0dd7, 0x183a, 0x0d49,
+    0x183c, 0x10df, 0x183b, 0x0c49, 0x1842, 0x1844, 0x1845, 0x0cf3,
+    0x1843, 0x1840, 0x183d, 0x183e, 0x1841, 0x1848, 0x1846, 0x1847,
+    0x1849, 0x184b, 0x184c, 0x184d, 0x184e, 0x184a, 0x1850, 0x184f,
+    0x1851, 0x1103, 0x1854, 0x1852, 0x1853, 0x0760, 0x107c, 0x0f88,
+    0x1856, 0x1855, 0x1857, 0x1858, 0x185c, 0x1859, 0x185a, 0x185b,
+    0x185d, 0x185e, 0x185f, 0x1860, 0x1861, 0x0ead, 0x0daf, 0x1862,
+    0x0e92, 0x0f13, 0x1863, 0x1864, 0x0d89, 0x06c6, 0x0923, 0x1865,
+    0x1866, 0x1867, 0x09c8, 0x1869, 0x1868, 0x186a, 0x186b, 0x0ee7,
+    0x186c, 0x186d, 0x1f09, 0x186e, 0x186f, 0x1870, 0x09cd, 0x1871,
+    0x0e75, 0x0ffe, 0x062d, 0x0636, 0x1872, 0x1874, 0x1873, 0x0dd0,
+    0x0bb7, 0x1698, 0x1875, 0x103f, 0x1876, 0x0744, 0x0ed5, 0x1877,
+    0x1878, 0x1879, 0x105a, 0x1053, 0x0d3c, 0x0c4a, 0x187b, 0x0ac2,
+    0x0b08, 0x187e, 0x187d, 0x187c, 0x0efb, 0x0745, 0x08a7, 0x1884,
+    0x1881, 0x0b5e, 0x1030, 0x1880, 0x1882, 0x1883, 0x187f, 0x1885,
+    0x1886, 0x0d2d, 0x0761, 0x0d05, 0x1887, 0x1888, 0x188b, 0x0b87,
+    0x0e02, 0x188c, 0x0ff2, 0x1889, 0x188a, 0x188f, 0x188e, 0x188d,
+    0x1891, 0x1890, 0x1892, 0x1894, 0x1893, 0x0f8b, 0x0ab5, 0x1104,
+    0x1895, 0x0df5, 0x1896, 0x1897, 0x189b, 0x1899, 0x189a, 0x1898,
+    0x189c, 0x189d, 0x189e, 0x189f, 0x1035, 0x18a0, 0x106e, 0x18a1,
+    0x0ced, 0x0e8a, 0x0829, 0x0cda, 0x18a2, 0x07f8, 0x0bce, 0x18a3,
+    0x097b, 0x18a4, 0x18a5, 0x08a4, 0x0993, 0x18a7, 0x0db5, 0x0994,
+    0x07ad, 0x0fc3, 0x0e6a, 0x0db6, 0x093b, 0x18a9, 0x0b09, 0x10f0,
+    0x0924, 0x08a5, 0x0ea1, 0x18ab, 0x18ad, 0x08e9, 0x18ac, 0x0d74,
+    0x18af, 0x06d6, 0x18aa, 0x0ee8, 0x060f, 0x09aa, 0x1171, 0x18ae,
+    0x18b0, 0x0f89, 0x0bd7, 0x18b2, 0x18b3, 0x18b1, 0x06ed, 0x18b9,
+    0x18b8, 0x0a25, 0x18ba, 0x18b5, 0x18bb, 0x18b6, 0x0ed6, 0x18b4,
+    0x18b7, 0x18c1, 0x18c0, 0x1001, 0x18bc, 0x05e9, 0x18c3, 0x18c2,
+    0x0b0a, 0x18c4, 0x0c22, 0x18c6, 0x18c5, 0x18c7, 0x18a6, 0x18a8,
+    0x18c9, 0x18c8, 0x0a26, 0x1127, 0x0a50, 0x18ca, 0x0856, 0x079f,
+    0x0786, 0x0a03, 0x1093, 0x18d0, 0x18cf, 0x0c23, 0x18cc, 0x18ce,
+    0x0aaa, 0x0b5f, 0x18cd, 0x18cb, 0x0e49, 0x0b0b, 0x0f1b, 0x0995,
+    0x0dd8, 0x18d1, 0x18d2, 0x18e8, 0x0816, 0x115c, 0x0c14, 0x18d3,
+    0x0690, 0x0d75, 0x0f5f, 0x18d4, 0x07da, 0x18d5, 0x18d7, 0x18d8,
+    0x0e48, 0x18d9, 0x18da, 0x18db, 0x0817, 0x0691, 0x0e03, 0x0a87,
+    0x0a04, 0x18dc, 0x0a88, 0x0688, 0x0f22, 0x18dd, 0x0ee9, 0x0c24,
+    0x18e0, 0x18e1, 0x0e89, 0x0b60, 0x18de, 0x0d01, 0x18df, 0x0b0c,
+    0x05da, 0x0788, 0x18e2, 0x0d76, 0x18e3, 0x0bc5, 0x102b, 0x0f02,
+    0x18e4, 0x18e5, 0x0cf4, 0x1105, 0x18e7, 0x18e6, 0x0a6d, 0x18e9,
+    0x05ee, 0x18ec, 0x18ea, 0x0692, 0x086d, 0x18eb, 0x0925, 0x0952,
+    0x0fa4, 0x18ed, 0x0ff3, 0x18ef, 0x0bcf, 0x062e, 0x0678, 0x05aa,
+    0x18ee, 0x18f0, 0x18f1, 0x0b35, 0x18f2, 0x06ee, 0x18f4, 0x088a,
+    0x07c6, 0x18f5, 0x0833, 0x18f6, 0x0bfa, 0x0e0b, 0x0bde, 0x09b3,
+    0x18f7, 0x0d02, 0x0c4b, 0x18f9, 0x18fb, 0x18f8, 0x18fa, 0x0841,
+    0x18fc, 0x0845, 0x07c7, 0x10b1, 0x18fe, 0x1900, 0x060d, 0x1903,
+    0x0716, 0x1902, 0x1901, 0x1905, 0x18fd, 0x1906, 0x10e7, 0x1907,
+    0x1908, 0x1372, 0x190a, 0x1909, 0x190b, 0x190c, 0x10f3, 0x190d,
+    0x1ded, 0x0b0d, 0x190e, 0x190f, 0x0ab6, 0x0df6, 0x1910, 0x0cc7,
+    0x1911, 0x0cdb, 0x1912, 0x07e3, 0x121e, 0x0cfc, 0x0a31, 0x0746,
+    0x1913, 0x1920, 0x1916, 0x07c8, 0x1915, 0x1922, 0x1914, 0x0b0e,
+    0x1918, 0x1919, 0x0d8a, 0x191a, 0x06fd, 0x0b79, 0x0f44, 0x191c,
+    0x0ca6, 0x1917, 0x191b, 0x191d, 0x09b9, 0x1924, 0x0f0d, 0x0ea4,
+    0x0dd9, 0x0818, 0x1923, 0x1921, 0x0eb3, 0x191e, 0x0cfd, 0x0ddb,
+    0x0dda, 0x09b4, 0x1936, 0x1926, 0x1928, 0x192b, 0x192c, 0x1929,
+    0x192a, 0x1927, 0x1925, 0x191f, 0x0f8d, 0x0693, 0x1933, 0x1930,
+    0x1935, 0x1934, 0x0e93, 0x1025, 0x09da, 0x192e, 0x1937, 0x1932,
+    0x1931, 0x192d, 0x192f, 0x0747, 0x0cdc, 0x0bfb, 0x0ea0, 0x193c,
+    0x0ea2, 0x0bdf, 0x1939, 0x0ecd, 0x193d, 0x0f91, 0x0cfa, 0x1938,
+    0x193a, 0x193b, 0x193e, 0x0a42, 0x0e04, 0x1943, 0x1942, 0x193f,
+    0x1155, 0x1948, 0x194c, 0x1949, 0x1945, 0x1946, 0x194b, 0x1940,
+    0x1293, 0x1947, 0x1941, 0x194a, 0x1950, 0x0748, 0x194d, 0x194e,
+    0x194f, 0x1952, 0x1951, 0x0ef4, 0x1953, 0x113a, 0x0fab, 0x1958,
+    0x1955, 0x1954, 0x0bd0, 0x1957, 0x1959, 0x1956, 0x195d, 0x195a,
+    0x195b, 0x1944, 0x195c, 0x195e, 0x195f, 0x0f84, 0x1960, 0x1060,
+    0x080c, 0x0848, 0x1961, 0x0f72, 0x0b88, 0x102e, 0x1962, 0x10f1,
+    0x0e94, 0x0c25, 0x0e53, 0x0aac, 0x05be, 0x1967, 0x1965, 0x1963,
+    0x071f, 0x0b0f, 0x1968, 0x1966, 0x1964, 0x196c, 0x196b, 0x196a,
+    0x1969, 0x196d, 0x196e, 0x0bb8, 0x196f, 0x1971, 0x1970, 0x08d0,
+    0x0c17, 0x1973, 0x0ddc, 0x1972, 0x1974, 0x0f73, 0x0c4c, 0x0926,
+    0x1975, 0x1106, 0x1977, 0x1978, 0x1979, 0x197a, 0x0a05, 0x197b,
+    0x086e, 0x07ca, 0x0789, 0x1980, 0x1071, 0x0927, 0x197c, 0x1983,
+    0x1064, 0x0e5b, 0x0f12, 0x0ac3, 0x1982, 0x0a51, 0x0928, 0x0a06,
+    0x07c9, 0x0f74, 0x1981, 0x0c26, 0x0fe1, 0x09b5, 0x0a07, 0x0d5b,
+    0x1986, 0x111d, 0x0997, 0x1987, 0x0b61, 0x1989, 0x0b10, 0x096e,
+    0x1988, 0x0a89, 0x08bc, 0x0c27, 0x1984, 0x198a, 0x1985, 0x086f,
+    0x198d, 0x1991, 0x088b, 0x198c, 0x1995, 0x0929, 0x10cd, 0x05ba,
+    0x1992, 0x07cb, 0x198f, 0x1990, 0x0ddd, 0x198e, 0x198b, 0x06c7,
+    0x0be2, 0x08a6, 0x1997, 0x1994, 0x1996, 0x1993, 0x0870, 0x0c71,
+    0x1998, 0x0c4e, 0x19a5, 0x19a1, 0x199b, 0x199f, 0x0a78, 0x05db,
+    0x199a, 0x19a2, 0x19a6, 0x092a, 0x1054, 0x0d54, 0x199c, 0x19a4,
+    0x1999, 0x0cdd, 0x199e, 0x05bb, 0x1048, 0x199d, 0x0819, 0x0eea,
+    0x0c4d, 0x110e, 0x0acf, 0x19ce, 0x19a7, 0x0bfc, 0x19a3, 0x19a8,
+    0x19aa, 0x0d77, 0x19ad, 0x19a9, 0x0f92, 0x0749, 0x1049, 0x05dc,
+    0x19ac, 0x113b, 0x19ab, 0x064f, 0x0e2a, 0x19ae, 0x19b5, 0x19af,
+    0x19b6, 0x19b2, 0x0e9b, 0x0a48, 0x19b4, 0x19b1, 0x19b7, 0x19b0,
+    0x0aa3, 0x0fc4, 0x0aab, 0x19b3, 0x19c0, 0x19bb, 0x19be, 0x19bc,
+    0x19c1, 0x19ba, 0x19a0, 0x0bd1, 0x0ec9, 0x19bd, 0x19b8, 0x0c00,
+    0x0871, 0x0a8a, 0x0b44, 0x0c15, 0x19c4, 0x19c6, 0x19c7, 0x19c3,
+    0x19c5, 0x19b9, 0x19c2, 0x19ca, 0x19c9, 0x101a, 0x084a, 0x19c8,
+    0x19cc, 0x19cb, 0x19cf, 0x19d1, 0x09db, 0x19cd, 0x19d2, 0x19d3,
+    0x19d4, 0x19da, 0x0d9a, 0x19d6, 0x19d5, 0x19d7, 0x19d8, 0x19d9,
+    0x19db, 0x19dc, 0x074a, 0x19dd, 0x19de, 0x19df, 0x19e0, 0x19e1,
+    0x19e2, 0x19e3, 0x19e4, 0x19e6, 0x19e5, 0x19e7, 0x19e8, 0x19e9,
+    0x19ec, 0x19ea, 0x19eb, 0x099f, 0x0872, 0x0cf5, 0x0eb1, 0x0ad0,
+    0x0e6c, 0x0eeb, 0x19ed, 0x14eb, 0x19ee, 0x19f0, 0x10c5, 0x19ef,
+    0x19f2, 0x19f1, 0x10b2, 0x19f3, 0x0efc, 0x19f4, 0x19f7, 0x19f6,
+    0x19f5, 0x19f8, 0x0851, 0x0c01, 0x07a0, 0x19fc, 0x19f9, 0x19fa,
+    0x19fd, 0x19fe, 0x19fb, 0x0608, 0x0665, 0x1a00, 0x1a01, 0x1a02,
+    0x10c2, 0x0a8b, 0x1a04, 0x1a03, 0x0b89, 0x1a05, 0x1a06, 0x1a07,
+    0x0763, 0x074b, 0x1a08, 0x1a09, 0x0ffc, 0x10c3, 0x10b3, 0x1156,
+    0x092c, 0x1a0c, 0x0a52, 0x1a0b, 0x1a0d, 0x0a27, 0x0c8f, 0x1a0e,
+    0x092b, 0x1055, 0x1a0f, 0x1a10, 0x1a11, 0x1a12, 0x1a13, 0x0a28,
+    0x106b, 0x1a15, 0x0cde, 0x1a14, 0x1a17, 0x1a16, 0x1a18, 0x0bb9,
+    0x1a19, 0x1a1a, 0x0f77, 0x1a1b, 0x0c4f, 0x1a1c, 0x1a1d, 0x113c,
+    0x1a20, 0x1a1f, 0x1a1e, 0x0d2e, 0x1a21, 0x0b45, 0x1a22, 0x1a23,
+    0x1157, 0x1a24, 0x1a25, 0x1a27, 0x1a26, 0x0ea3, 0x0e37, 0x115d,
+    0x0ea7, 0x1a29, 0x0b11, 0x0f09, 0x1a2a, 0x1a28, 0x074c, 0x08d2,
+    0x0a08, 0x0eec, 0x08a8, 0x0fe2, 0x1a2d, 0x1a2b, 0x092d, 0x092e,
+    0x05e7, 0x09a6, 0x0e78, 0x05dd, 0x1a32, 0x0cdf, 0x0e77, 0x0c99,
+    0x1a34, 0x1a30, 0x1a33, 0x1a2e, 0x1a31, 0x0fc5, 0x08d3, 0x05fb,
+    0x1a2f, 0x1a36, 0x1a37, 0x0df7, 0x07f9, 0x1a45, 0x0e5c, 0x0a09,
+    0x07fa, 0x0bc6, 0x1165, 0x102c, 0x1a35, 0x0bd2, 0x07b2, 0x1a38,
+    0x1a3a, 0x1a39, 0x1a3b, 0x0cc5, 0x0e5d, 0x0d2f, 0x1a42, 0x1a41,
+    0x1a3c, 0x0b74, 0x0f45, 0x1a44, 0x1a43, 0x092f, 0x1172, 0x1a54,
+    0x1a48, 0x1a49, 0x0a6e, 0x1a47, 0x0958, 0x1a46, 0x1a4a, 0x0d30,
+    0x0f60, 0x0c02, 0x0c9a, 0x1a4e, 0x1a4f, 0x1a4b, 0x1a4c, 0x1a4d,
+    0x0930, 0x1a55, 0x1a51, 0x0f46, 0x100c, 0x0f07, 0x1a50, 0x1a53,
+    0x1a52, 0x0fe3, 0x1a56, 0x1a57, 0x0c16, 0x1a58, 0x1a5a, 0x1a5e,
+    0x1a5b, 0x1a59, 0x0e5e, 0x1a5c, 0x1a5d, 0x0670, 0x1a64, 0x1a5f,
+    0x1a60, 0x1a61, 0x0c5f, 0x1a63, 0x1a62, 0x1a65, 0x1a66, 0x1a67,
+    0x0b62, 0x06a7, 0x1a68, 0x1115, 0x0a29, 0x0a8c, 0x0a0a, 0x0cf6,
+    0x1a69, 0x1a6a, 0x0610, 0x1a6b, 0x1a6c, 0x1a6d, 0x1a6e, 0x1a6f,
+    0x07fb, 0x1568, 0x1a70, 0x0be3, 0x1a71, 0x0a49, 0x1a72, 0x11ae,
+    0x1a73, 0x0f9c, 0x075a, 0x0c03, 0x0ab7, 0x0f51, 0x0a8d, 0x1a74,
+    0x0931, 0x1a75, 0x0eca, 0x1a84, 0x1a77, 0x0c87, 0x0e95, 0x08bd,
+    0x1a76, 0x0c04, 0x1a78, 0x0d78, 0x1a7a, 0x1a79, 0x1a7c, 0x1a7b,
+    0x1a7d, 0x1a80, 0x1a7e, 0x074d, 0x1a81, 0x1a82, 0x1a83, 0x096f,
+    0x1107, 0x1a85, 0x0b46, 0x0650, 0x1a86, 0x1a87, 0x1a88, 0x05f0,
+    0x1a89, 0x1a8a, 0x0f47, 0x0a45, 0x1a8c, 0x06c8, 0x05b0, 0x1a8b,
+    0x1a8e, 0x0e6d, 0x0b63, 0x0694, 0x0fc6, 0x087c, 0x081a, 0x1a8d,
+    0x06a8, 0x0721, 0x0651, 0x1a92, 0x1128, 0x0c9b, 0x0f23, 0x1a9e,
+    0x0695, 0x1a9c, 0x1a9a, 0x1a91, 0x1a8f, 0x1a90, 0x0a61, 0x082a,
+    0x0d17, 0x0e0f, 0x0630, 0x1a94, 0x1a93, 0x1a99, 0x1a95, 0x1a98,
+    0x104e, 0x1a97, 0x0696, 0x071d, 0x1a9b, 0x1a9d, 0x0873, 0x1aa1,
+    0x1aaa, 0x1aab, 0x05a9, 0x1ab2, 0x05ef, 0x1aa9, 0x1aa8, 0x1aa3,
+    0x1aa2, 0x1aa0, 0x1a9f, 0x0d03, 0x0cb9, 0x1aa5, 0x1aa4, 0x1aa7,
+    0x0c50, 0x0874, 0x0620, 0x1aa6, 0x0932, 0x0c51, 0x1ab8, 0x1ab9,
+    0x0697, 0x066c, 0x1ab6, 0x1aac, 0x1ab4, 0x1abb, 0x1ab5, 0x1ab3,
+    0x1a96, 0x1ab1, 0x1aad, 0x074e, 0x1aaf, 0x1aba, 0x1ab0, 0x1abc,
+    0x1aae, 0x0e9c, 0x10c9, 0x1ab7, 0x1acd, 0x1ac5, 0x0b9b, 0x07a5,
+    0x081b, 0x1ac0, 0x0699, 0x0b12, 0x1ac3, 0x0998, 0x0db0, 0x1ac8,
+    0x0fac, 0x1abf, 0x0698, 0x08d4, 0x0f08, 0x1ac9, 0x1abd, 0x1ac6,
+    0x1ad0, 0x1ac1, 0x1ac2, 0x0df8, 0x1ac7, 0x1ac4, 0x0fc7, 0x1aca,
+    0x05de, 0x1abe, 0x1acc, 0x1acb, 0x0e8b, 0x1ad2, 0x1add, 0x071e,
+    0x1ae0, 0x1ace, 0x1ad3, 0x10ce, 0x1adc, 0x10b4, 0x10e8, 0x0d18,
+    0x070b, 0x0f52, 0x1ae2, 0x0ddf, 0x05af, 0x1adb, 0x1ad7, 0x0c52,
+    0x1ad1, 0x1ad9, 0x1ade, 0x0e4b, 0x05a8, 0x1ad6, 0x1adf, 0x0f58,
+    0x1ada, 0x1ad5, 0x0b13, 0x0a8e, 0x0a2a, 0x1056, 0x0f26, 0x1ae5,
+    0x1aee, 0x1ad8, 0x0717, 0x0b36, 0x1ae3, 0x1ae8, 0x0c53, 0x1ae4,
+    0x1aeb, 0x0cfe, 0x1aec, 0x10b5, 0x1ae1, 0x06d7, 0x1ae7, 0x1aea,
+    0x102a, 0x1aed, 0x1ae6, 0x1ae9, 0x0fc8, 0x1140, 0x1af1, 0x1af8,
+    0x1af0, 0x0a41, 0x1acf, 0x0f8c, 0x1020, 0x1af7, 0x1af6, 0x1af2,
+    0x1af3, 0x0615, 0x1af5, 0x1aef, 0x0d53, 0x1af4, 0x05fc, 0x0c60,
+    0x0f81, 0x1af9, 0x1b00, 0x0ed7, 0x1afc, 0x0b14, 0x0a47, 0x1b02,
+    0x07fc, 0x1b03, 0x0f59, 0x1afb, 0x1ad4, 0x1afa, 0x116e, 0x0de0,
+    0x0f53, 0x1b0a, 0x1b10, 0x1b11, 0x1b04, 0x0e96, 0x1b0e, 0x1b06,
+    0x1b08, 0x1b12, 0x1b07, 0x1b0b, 0x0652, 0x0e23, 0x1b0c, 0x1b0f,
+    0x1b05, 0x0c05, 0x1b09, 0x09c6, 0x0b64, 0x084f, 0x1072, 0x1077,
+    0x0ad2, 0x1b16, 0x1b14, 0x116d, 0x1b13, 0x10d5, 0x1b15, 0x1b17,
+    0x1b18, 0x1b1b, 0x1b19, 0x0de1, 0x1b1a, 0x0ecb, 0x1b0d, 0x0ad3,
+    0x1b1c, 0x1b21, 0x0c54, 0x1b20, 0x1b01, 0x1b22, 0x0c28, 0x1b1d,
+    0x1b1f, 0x1b1e, 0x1690, 0x1681, 0x1b24, 0x1b23, 0x10d6, 0x187a,
+    0x1b25, 0x1b26, 0x1b27, 0x08d5, 0x07b3, 0x1b29, 0x123c, 0x07d5,
+    0x10f8, 0x0831, 0x1b2a, 0x1b2b, 0x0d0e, 0x1b2c, 0x0e38, 0x05b8,
+    0x06a1, 0x1b31, 0x1b32, 0x1b2d, 0x09dc, 0x1b2e, 0x0e61, 0x1b2f,
+    0x1b30, 0x1b3a, 0x1b34, 0x1b37, 0x1b33, 0x1b35, 0x1b36, 0x0a56,
+    0x1b38, 0x0ce0, 0x0875, 0x06e1, 0x1b3b, 0x06de, 0x1b41, 0x1b3c,
+    0x1b40, 0x0eb8, 0x1b3d, 0x1b3e, 0x0f27, 0x0ed8, 0x1b42, 0x0cbb,
+    0x1b4c, 0x1b48, 0x06a9, 0x1b46, 0x0fc9, 0x1b47, 0x1b44, 0x1b45,
+    0x1b4a, 0x1b4d, 0x1b4b, 0x1b49, 0x1b43, 0x0cf7, 0x1b54, 0x1028,
+    0x1b52, 0x1b53, 0x1b4e, 0x1b50, 0x1b51, 0x1b4f, 0x0be4, 0x1158,
+    0x1b58, 0x1b59, 0x1b5f, 0x0b49, 0x1b5b, 0x1b5e, 0x1b56, 0x1b55,
+    0x1b60, 0x069a, 0x1b5c, 0x1b61, 0x1b5d, 0x1b5a, 0x0d31, 0x1b57,
+    0x0e88, 0x1b65, 0x109a, 0x1b64, 0x1b63, 0x1b6c, 0x1b66, 0x1b6e,
+    0x10c6, 0x1b71, 0x1b68, 0x1b69, 0x1b6d, 0x1b70, 0x1b6f, 0x1b67,
+    0x1b6a, 0x1b7b, 0x1b74, 0x1b72, 0x1b73, 0x1b78, 0x1b79, 0x06c9,
+    0x07a1, 0x1b77, 0x1b62, 0x1b76, 0x1b7a, 0x1b75, 0x1b7c, 0x1b7e,
+    0x1b7d, 0x1b80, 0x1b7f, 0x1b39, 0x1b84, 0x1b81, 0x1b82, 0x1b83,
+    0x1b85, 0x088c, 0x1b87, 0x1b86, 0x0a8f, 0x0933, 0x16e5, 0x1b88,
+    0x0ab0, 0x06d8, 0x1b89, 0x0631, 0x0b15, 0x1b8a, 0x0934, 0x1b8b,
+    0x05df, 0x0f1c, 0x1b8c, 0x0b8a, 0x1b93, 0x1b90, 0x0d0f, 0x1b91,
+    0x1b8e, 0x081c, 0x1b8d, 0x1b94, 0x0855, 0x0c9c, 0x1b9a, 0x1b96,
+    0x0c73, 0x1b95, 0x1b98, 0x1b8f, 0x1b99, 0x1b9b, 0x0eed, 0x1b97,
+    0x1b9c, 0x1b9e, 0x08d1, 0x1b92, 0x05bf, 0x1b9d, 0x0999, 0x1134,
+    0x1b9f, 0x1ba0, 0x0c55, 0x10e0, 0x1ba1, 0x1094, 0x1ba2, 0x1ba3,
+    0x0fa2, 0x1ba4, 0x097e, 0x10e1, 0x1ba9, 0x1baa, 0x0b16, 0x1ba8,
+    0x10c7, 0x1ba5, 0x1ba7, 0x0bbb, 0x0b9e, 0x1ba6, 0x1bab, 0x0f61,
+    0x1bad, 0x1bac, 0x070c, 0x0fca, 0x1bae, 0x1bba, 0x1bb0, 0x1bb1,
+    0x1bb2, 0x1bb3, 0x1bb7, 0x1bb8, 0x1bb6, 0x1bb4, 0x1baf, 0x1bb5,
+    0x1bb9, 0x1db5, 0x0666, 0x1bbc, 0x081d, 0x1bbb, 0x1bc1, 0x1bc0,
+    0x1bc3, 0x1bc2, 0x1bc4, 0x0a90, 0x1bc5, 0x1bc6, 0x1bc7, 0x0bbc,
+    0x10b6, 0x1bc8, 0x0f62, 0x0e65, 0x1bc9, 0x1bca, 0x08a9, 0x078b,
+    0x1bcb, 0x0a0b, 0x0e60, 0x1bcc, 0x06ef, 0x1bcd, 0x1bcf, 0x10d7,
+    0x1bce, 0x0b65, 0x1bd0, 0x1bd1, 0x1bd2, 0x074f, 0x1bd3, 0x1bd4,
+    0x1bd5, 0x1bd6, 0x06f0, 0x1bd7, 0x1bd8, 0x1bd9, 0x06b0, 0x0b47,
+    0x1bda, 0x1bdb, 0x1bdc, 0x08be, 0x0d79, 0x1bdd, 0x0876, 0x0b75,
+    0x1be0, 0x0de2, 0x1bdf, 0x0850, 0x1bde, 0x0cb5, 0x078c, 0x1be1,
+    0x1be2, 0x0b17, 0x088d, 0x1be3, 0x0fcb, 0x0bdd, 0x07d6, 0x1073,
+    0x0c29, 0x1be4, 0x0b66, 0x0d10, 0x0b18, 0x1be5, 0x1be8, 0x1be9,
+    0x097c, 0x0c80, 0x1be7, 0x0b19, 0x0f1d, 0x1be6, 0x0a0c, 0x0632,
+    0x1bed, 0x0877, 0x0a0e, 0x0a0d, 0x116c, 0x1bec, 0x1beb, 0x0c06,
+    0x07ac, 0x1162, 0x06d9, 0x0b1a, 0x1bea, 0x1bef, 0x1bf0, 0x1bee,
+    0x08d6, 0x109f, 0x0a0f, 0x0e46, 0x1bf3, 0x0bbe, 0x0ce1, 0x1095,
+    0x1bf6, 0x08ea, 0x0bbd, 0x1bf2, 0x1bf7, 0x08eb, 0x1bf4, 0x1bf5,
+    0x1bf1, 0x0be0, 0x0e07, 0x0cce, 0x069b, 0x0eee, 0x07a2, 0x0d32,
+    0x1bfa, 0x1bf8, 0x0ceb, 0x0bbf, 0x0750, 0x1bf9, 0x0b7a, 0x1108,
+    0x115f, 0x1bfb, 0x1c07, 0x0d33, 0x1c06, 0x1c03, 0x1c0b, 0x1c04,
+    0x1c00, 0x0d7a, 0x1bfe, 0x1bfc, 0x1080, 0x0a10, 0x1c01, 0x1bfd,
+    0x1c05, 0x0ad4, 0x08bf, 0x0cb8, 0x0fe4, 0x0639, 0x05e0, 0x0de3,
+    0x1c09, 0x1c08, 0x0e24, 0x1c0d, 0x1c02, 0x1c0c, 0x1c0e, 0x08aa,
+    0x1c0a, 0x0935, 0x0a53, 0x1c0f, 0x10b7, 0x1c12, 0x1c15, 0x1c13,
+    0x0f14, 0x1c10, 0x081e, 0x1c14, 0x1c16, 0x1c1a, 0x1c17, 0x1c19,
+    0x1c18, 0x1c1b, 0x0a2f, 0x1c1d, 0x1c1c, 0x0f48, 0x1c1f, 0x0878,
+    0x1c1e, 0x1c20, 0x1c21, 0x07a3, 0x19ff, 0x0b37, 0x1c22, 0x08ec,
+    0x1c23, 0x1c24, 0x09dd, 0x158c, 0x1c25, 0x1c26, 0x0a91, 0x1c27,
+    0x1c28, 0x1c29, 0x1c2a, 0x1c2b, 0x0cca, 0x1c2c, 0x1c2e, 0x1c2d,
+    0x0de4, 0x1c2f, 0x0fcc, 0x1c30, 0x1c31, 0x1c32, 0x1c33, 0x0e18,
+    0x0b1b, 0x1c34, 0x094b, 0x11ac, 0x1c35, 0x1c36, 0x0f1e, 0x1c37,
+    0x1c3f, 0x1c38, 0x1c3a, 0x1c39, 0x1c3b, 0x0fe5, 0x1c3c, 0x1c3d,
+    0x1c3e, 0x1c40, 0x06cc, 0x0d65, 0x0f49, 0x09a0, 0x0936, 0x0f2e,
+    0x069d, 0x0ecc, 0x1c43, 0x0751, 0x0bd3, 0x1c42, 0x1c47, 0x0d19,
+    0x1061, 0x1c45, 0x1c46, 0x078d, 0x1c48, 0x0e83, 0x0c9d, 0x0eef,
+    0x0d9c, 0x1c44, 0x0fe6, 0x06aa, 0x1c4a, 0x1147, 0x0d40, 0x1164,
+    0x0a11, 0x1c49, 0x0c6f, 0x1c5a, 0x0c07, 0x0e36, 0x0f2f, 0x1c4d,
+    0x09de, 0x0a12, 0x0b1c, 0x0e85, 0x08ab, 0x1c4c, 0x1c4b, 0x0f4a,
+    0x0a3f, 0x0db1, 0x1c4f, 0x1c50, 0x0937, 0x1c4e, 0x1c51, 0x1c52,
+    0x1c54, 0x0c61, 0x1c53, 0x0764, 0x1c56, 0x1c55, 0x1c57, 0x1c59,
+    0x1c5b, 0x1c5c, 0x0bd4, 0x0a4d, 0x1c5d, 0x06f1, 0x1c5e, 0x0c56,
+    0x1c5f, 0x1c60, 0x0f4b, 0x078e, 0x1c61, 0x0d34, 0x063a, 0x1c62,
+    0x0a6f, 0x0b96, 0x0c6b, 0x1c65, 0x1c64, 0x1c63, 0x1c6b, 0x1c69,
+    0x1c66, 0x1c68, 0x1c67, 0x1c6a, 0x07d7, 0x1c6e, 0x0bd5, 0x1c6f,
+    0x08d7, 0x1c6c, 0x1c6d, 0x1148, 0x0d35, 0x0c08, 0x1c70, 0x1c73,
+    0x1c71, 0x1c72, 0x10b8, 0x0de5, 0x1c76, 0x1c74, 0x1c75, 0x1c77,
+    0x1c88, 0x1c7a, 0x1c7b, 0x1c79, 0x1c78, 0x0d7b, 0x1c80, 0x1c84,
+    0x1c81, 0x1c7c, 0x1c82, 0x1c83, 0x1c8a, 0x1c85, 0x0bd6, 0x1c87,
+    0x1c89, 0x1c86, 0x1c8c, 0x0a92, 0x1c8b, 0x1c8d, 0x1c8e, 0x1c91,
+    0x1c90, 0x1c8f, 0x1c93, 0x1c92, 0x1074, 0x1c95, 0x1c94, 0x1c96,
+    0x1c97, 0x1c99, 0x1c98, 0x0b67, 0x1c9a, 0x082b, 0x1c9b, 0x1c9d,
+    0x1c9e, 0x1c9f, 0x1c9c, 0x1ca0, 0x0a54, 0x1ca1, 0x078f, 0x0852,
+    0x08ac, 0x1ca2, 0x0e2e, 0x0d9d, 0x1ca3, 0x1ca6, 0x0a32, 0x1ca5,
+    0x1ca4, 0x0879, 0x1ca7, 0x06f2, 0x1ca9, 0x099a, 0x1ca8, 0x1cb1,
+    0x1cab, 0x1cad, 0x0fa3, 0x1caa, 0x1cac, 0x1cb0, 0x1cae, 0x0790,
+    0x1caf, 0x1cb2, 0x0e79, 0x1116, 0x0a93, 0x1cb3, 0x1081, 0x1cb5,
+    0x1cb4, 0x1cb8, 0x10a0, 0x1cb7, 0x070d, 0x1cb6, 0x1cbb, 0x1cba,
+    0x1cb9, 0x0d91, 0x1cbc, 0x1cbd, 0x1cbe, 0x094c, 0x0844, 0x1cc0,
+    0x1cc1, 0x1cc2, 0x0b68, 0x1cc3, 0x0a2b, 0x1cc4, 0x1cc5, 0x125f,
+    0x125e, 0x1cc6, 0x19d0, 0x1cc7, 0x0cc3, 0x0b4a, 0x0e5f, 0x1cc8,
+    0x0f93, 0x0d52, 0x095e, 0x0cc8, 0x0609, 0x1018, 0x0b76, 0x087d,
+    0x081f, 0x0f94, 0x1cc9, 0x1ccb, 0x1cca, 0x069e, 0x0e34, 0x1ccc,
+    0x0e97, 0x0d92, 0x1ccd, 0x0ab1, 0x1ccf, 0x1040, 0x1cde, 0x1cd1,
+    0x1cd2, 0x0d47, 0x0c9e, 0x0c57, 0x0de6, 0x1cd0, 0x07b4, 0x1cd9,
+    0x1cd6, 0x1ce3, 0x0de7, 0x0d00, 0x1cd3, 0x0d7c, 0x0db2, 0x1cd4,
+    0x1cd8, 0x0b80, 0x0e87, 0x0d4a, 0x0bc0, 0x1cd7, 0x0c6c, 0x0c62,
+    0x1cd5, 0x05a7, 0x1141, 0x1cda, 0x0c9f, 0x0a94, 0x0b69, 0x1cdc,
+    0x1cdb, 0x05ed, 0x1cdd, 0x0f0e, 0x1ce5, 0x0e19, 0x0b8b, 0x0cf8,
+    0x0836, 0x1ce4, 0x1096, 0x061e, 0x0f95, 0x069f, 0x1cdf, 0x1ce0,
+    0x1ce1, 0x1ce2, 0x0df9, 0x0cc2, 0x05e1, 0x1ce6, 0x1ce7, 0x1f21,
+    0x0c7b, 0x1ce8, 0x0653, 0x0c2b, 0x08ad, 0x10b9, 0x1ce9, 0x0d8b,
+    0x0c58, 0x0a55, 0x1cea, 0x1ced, 0x0ac5, 0x1ceb, 0x0c0a, 0x0c09,
+    0x05e2, 0x1109, 0x1cef, 0x0ef0, 0x1cf1, 0x1cf0, 0x1cee, 0x1904,
+    0x0752, 0x1cce, 0x1cf3, 0x1cf2, 0x1cf4, 0x1097, 0x0e1f, 0x0fcd,
+    0x1cf5, 0x0a57, 0x1cf6, 0x1cf7, 0x1cf8, 0x0d80, 0x05e8, 0x0938,
+    0x1159, 0x1cfc, 0x0853, 0x1cf9, 0x1cfa, 0x0f54, 0x06f3, 0x1098,
+    0x07fd, 0x0db3, 0x1cfd, 0x1cfe, 0x1cff, 0x0d81, 0x1d01, 0x1d00,
+    0x0e11, 0x1d02, 0x0a95, 0x0a5e, 0x0e7a, 0x0d11, 0x0a70, 0x0b8c,
+    0x1d03, 0x1d04, 0x0b7c, 0x1d05, 0x1d06, 0x1d07, 0x10cf, 0x0a96,
+    0x1d09, 0x1d08, 0x0939, 0x0953, 0x09df, 0x1d0c, 0x0ac6, 0x1d0b,
+    0x1d0a, 0x0ca7, 0x08ed, 0x0bc1, 0x0eae, 0x0a98, 0x1d0d, 0x0b1d,
+    0x1d10, 0x1d0e, 0x1d0f, 0x1d12, 0x1d11, 0x0b38, 0x1d13, 0x1d14,
+    0x1d15, 0x0ece, 0x0991, 0x0a5f, 0x1d16, 0x1d17, 0x10e2, 0x0aa4,
+    0x106c, 0x110a, 0x1d18, 0x0820, 0x1d19, 0x0d82, 0x1d1c, 0x0718,
+    0x0b6a, 0x1d1a, 0x1d1b, 0x0d5e, 0x0ff4, 0x083a, 0x1d1e, 0x1d1f,
+    0x1d1d, 0x1d21, 0x0e1d, 0x06e2, 0x1d25, 0x1d22, 0x1d24, 0x1d20,
+    0x1d6e, 0x1d23, 0x1129, 0x08d8, 0x1d2d, 0x0d93, 0x1d28, 0x1d2b,
+    0x1d29, 0x1d2e, 0x1d2f, 0x1d27, 0x1d34, 0x0654, 0x1d26, 0x0eab,
+    0x1d2a, 0x0b1e, 0x093a, 0x0fe7, 0x0822, 0x0aa5, 0x0dfa, 0x0c0c,
+    0x1d32, 0x1d2c, 0x1d31, 0x1041, 0x0d36, 0x1d33, 0x1d30, 0x0c0b,
+    0x1d37, 0x1d36, 0x1d35, 0x0fce, 0x0adb, 0x1d38, 0x0f9d, 0x0633,
+    0x0f25, 0x0d12, 0x07d8, 0x1d3a, 0x093c, 0x09cb, 0x1d39, 0x0b8d,
+    0x0b8e, 0x1d40, 0x1d42, 0x0b39, 0x1d41, 0x1d43, 0x0811, 0x0f24,
+    0x0a60, 0x1142, 0x1d3c, 0x09b6, 0x115e, 0x1d45, 0x1d44, 0x1d46,
+    0x1d3b, 0x0e27, 0x0db4, 0x0d55, 0x1d4b, 0x0ce2, 0x1d47, 0x1d48,
+    0x084c, 0x1d4a, 0x08ae, 0x1d49, 0x0b1f, 0x0719, 0x1d4f, 0x097d,
+    0x0c59, 0x0d48, 0x06da, 0x1d4d, 0x1d4e, 0x0d41, 0x1d4c, 0x1d50,
+    0x1d56, 0x1d59, 0x1d58, 0x0d8c, 0x1d51, 0x1d52, 0x1d55, 0x1d57,
+    0x07fe, 0x1d5a, 0x1d54, 0x1d53, 0x1d5e, 0x1d5f, 0x1d60, 0x1d5d,
+    0x1d5c, 0x0b20, 0x0de8, 0x1d5b, 0x1d64, 0x1d62, 0x1d63, 0x1d61,
+    0x0cb6, 0x1d65, 0x1d66, 0x1d68, 0x0753, 0x1d67, 0x1078, 0x1d73,
+    0x1d69, 0x1d6c, 0x1d6a, 0x1d6b, 0x1d6d, 0x1d6f, 0x1d70, 0x1d71,
+    0x1d74, 0x1d72, 0x1d75, 0x1d77, 0x1d76, 0x0d37, 0x1065, 0x1d78,
+    0x0c0d, 0x1d79, 0x0f82, 0x1d7a, 0x06ca, 0x061b, 0x0755, 0x0754,
+    0x1d7b, 0x1d7c, 0x1d7d, 0x1d7e, 0x1d80, 0x0756, 0x06f4, 0x093d,
+    0x0eb4, 0x1d82, 0x1d81, 0x1d83, 0x063b, 0x1d86, 0x1d85, 0x1d84,
+    0x1d87, 0x1d8a, 0x05c5, 0x1d88, 0x1d8c, 0x1d8b, 0x1d8e, 0x1d8d,
+    0x1d8f, 0x0dec, 0x1d90, 0x1d91, 0x1d93, 0x1d92, 0x0f4c, 0x1d94,
+    0x1d95, 0x09a3, 0x1d96, 0x1d97, 0x0fe8, 0x0c2a, 0x05a2, 0x0c89,
+    0x1d98, 0x0f4d, 0x1d9b, 0x1d99, 0x093e, 0x1d9a, 0x08c0, 0x0f83,
+    0x1d9d, 0x1d9f, 0x1d9e, 0x1da0, 0x0600, 0x0b77, 0x0adc, 0x0757,
+    0x1da1, 0x0e86, 0x1da3, 0x0601, 0x1da2, 0x0d42, 0x110b, 0x0de9,
+    0x1d9c, 0x10e4, 0x08af, 0x10ba, 0x0837, 0x10f2, 0x0847, 0x0ca0,
+    0x1a40, 0x1da4, 0x06cb, 0x0b8f, 0x06f5, 0x1da6, 0x1da7, 0x1da5,
+    0x0884, 0x099b, 0x0b21, 0x0602, 0x1117, 0x1da9, 0x1cec, 0x1da8,
+    0x1dac, 0x1daa, 0x1dab, 0x1dad, 0x1dae, 0x112a, 0x1daf, 0x1db0,
+    0x0bc7, 0x0eb9, 0x0b9d, 0x0765, 0x1099, 0x06ab, 0x0a97, 0x08d9,
+    0x1db3, 0x1db2, 0x0a13, 0x1db4, 0x1db1, 0x09c7, 0x1db8, 0x1b6b,
+    0x1294, 0x0b97, 0x1db6, 0x10e3, 0x0e2f, 0x060a, 0x0be1, 0x0a34,
+    0x0f75, 0x061f, 0x112b, 0x10cb, 0x1db9, 0x0da4, 0x0a79, 0x1dba,
+    0x1dbb, 0x0b6b, 0x1dbc, 0x112c, 0x1db7, 0x1dbe, 0x1dc0, 0x1dbf,
+    0x1dbd, 0x1dc1, 0x1dc2, 0x0c5a, 0x06a0, 0x1dc3, 0x1036, 0x1dc4,
+    0x1dc5, 0x1149, 0x15d0, 0x1dc6, 0x1dc7, 0x1dc8, 0x1dcc, 0x1dc9,
+    0x1dca, 0x1dcb, 0x1dcd, 0x0bc2, 0x1075, 0x0bc3, 0x1dce, 0x0ef1,
+    0x1dcf, 0x1ef2, 0x104a, 0x1dd0, 0x1dd1, 0x1dd2, 0x06f6, 0x1dd4,
+    0x0b78, 0x1dd5, 0x0843, 0x1dd6, 0x1dda, 0x1dd8, 0x1dd9, 0x0713,
+    0x1dd7, 0x1ddb, 0x1ddc, 0x05c6, 0x1ddd, 0x1dde, 0x0b22, 0x1ddf,
+    0x07a6, 0x1de2, 0x1de1, 0x1de0, 0x1c11, 0x0f9a, 0x1de3, 0x1de4,
+    0x1de5, 0x1de6, 0x1de7, 0x1de8, 0x0758, 0x1de9, 0x1dea, 0x0e42,
+    0x1dec, 0x0679, 0x1def, 0x1dee, 0x0603, 0x07ff, 0x0f85, 0x0d38,
+    0x0960, 0x0940, 0x0ac7, 0x0b7b, 0x1df1, 0x1df0, 0x10a1, 0x0766,
+    0x0ed0, 0x0e1a, 0x0b9c, 0x110c, 0x087a, 0x1df4, 0x1df3, 0x0fea,
+    0x0dea, 0x062f, 0x1df5, 0x1df2, 0x0f30, 0x10ca, 0x1df6, 0x1df7,
+    0x1df9, 0x0ca8, 0x06fa, 0x06fb, 0x1df8, 0x0767, 0x08b0, 0x0768,
+    0x0d9e, 0x111e, 0x08da, 0x1dfa, 0x1dfb, 0x1dfc, 0x1e00, 0x1e02,
+    0x1e01, 0x0f57, 0x1e03, 0x1e04, 0x1e05, 0x1e06, 0x1e08, 0x1e07,
+    0x1e09, 0x0ef2, 0x1a0a, 0x0b48, 0x0791, 0x1e0a, 0x1e0b, 0x126a,
+    0x169a, 0x0ed1, 0x05f9, 0x05b9, 0x0a14, 0x0fcf, 0x0b3c, 0x1e0c,
+    0x105d, 0x1e0d, 0x10bb, 0x0621, 0x09e0, 0x1e0e, 0x06ac, 0x1e0f,
+    0x1e10, 0x1e12, 0x1e13, 0x1e15, 0x1e11, 0x1e14, 0x0759, 0x1e16,
+    0x1e17, 0x1e18, 0x1e19, 0x1e1a, 0x1e1c, 0x1e1b, 0x1e1e, 0x1e21,
+    0x1e1d, 0x1e1f, 0x1e20, 0x1e22, 0x0800, 0x0a71, 0x1e23, 0x1e24,
+    0x0941, 0x1e25, 0x06dd, 0x0e6e, 0x1e26, 0x1e27, 0x0cf9, 0x0e29,
+    0x1e28, 0x0e9d, 0x0c8a, 0x0637, 0x082c, 0x082d, 0x0d13, 0x1e2d,
+    0x082e, 0x06ad, 0x1e2c, 0x1e2a, 0x1e2b, 0x1e29, 0x1e37, 0x1e2e,
+    0x1e2f, 0x1e30, 0x1e31, 0x1e33, 0x1e32, 0x0ab8, 0x1e34, 0x1e36,
+    0x0792, 0x1e35, 0x0c5b, 0x08b1, 0x1e38, 0x0c8b, 0x1e39, 0x0deb,
+    0x1e3a, 0x1e40, 0x1e3d, 0x1e3c, 0x1e3e, 0x1e3b, 0x1e42, 0x1e41,
+    0x1e44, 0x0801, 0x1e43, 0x1e45, 0x1e46, 0x1e48, 0x1e47, 0x1e49,
+    0x1e4b, 0x1e4a, 0x095c, 0x1e4c, 0x1e4d, 0x06db, 0x1e4e, 0x1e4f,
+    0x0b91, 0x1e50, 0x1e51, 0x1e52, 0x1e53, 0x0942, 0x1e54, 0x1e55,
+    0x1e56, 0x1e57, 0x1e58, 0x0eaf, 0x1e5a, 0x0f05, 0x1e5b, 0x1e59,
+    0x1e5d, 0x1e5c, 0x1e5e, 0x1e5f, 0x1e60, 0x1e61, 0x1e62, 0x1e63,
+    0x1e64, 0x1e65, 0x1e66, 0x1e67, 0x1e68, 0x1e69, 0x1e6a, 0x1e6b,
+    0x1e6c, 0x1694, 0x1e6d, 0x1976, 0x0793, 0x06c0, 0x0970, 0x1e6f,
+    0x1e6e, 0x1023, 0x1e71, 0x1e72, 0x1e70, 0x1e73, 0x1002, 0x1e74,
+    0x07db, 0x1144, 0x1e75, 0x1e77, 0x05bc, 0x1e78, 0x0f69, 0x1e76,
+    0x1e79, 0x1e7a, 0x1e7b, 0x1e7c, 0x1e7d, 0x100e, 0x09cc, 0x09b8,
+    0x0c0e, 0x1e7e, 0x1e81, 0x1e7f, 0x1e82, 0x08ef, 0x1e80, 0x1e83,
+    0x1e84, 0x1e85, 0x1e89, 0x09c9, 0x0ca2, 0x1e8a, 0x1e87, 0x1e86,
+    0x1e88, 0x087e, 0x1e8e, 0x1e8d, 0x1e8c, 0x05b1, 0x1e98, 0x1e94,
+    0x1e95, 0x1e91, 0x1e97, 0x1e93, 0x0702, 0x116b, 0x1e96, 0x1e92,
+    0x1e90, 0x1e8f, 0x1e9a, 0x1e9d, 0x1e9c, 0x1e9b, 0x0f28, 0x1e99,
+    0x05f1, 0x1e9e, 0x1ea0, 0x070f, 0x1e8b, 0x0616, 0x1ea2, 0x1ea1,
+    0x1e9f, 0x0ccc, 0x1010, 0x1118, 0x1ea3, 0x1ea4, 0x1ea5, 0x1ea6,
+    0x1ea7, 0x0d39, 0x1ea8, 0x0eb5, 0x1ead, 0x1ea9, 0x1eaa, 0x0fd0,
+    0x1042, 0x0e0e, 0x1eae, 0x1eaf, 0x0dfc, 0x1eac, 0x1eab, 0x0668,
+    0x1eb7, 0x1eb6, 0x0655, 0x1eb4, 0x1eb3, 0x1eb1, 0x071b, 0x1eb0,
+    0x0a30, 0x0667, 0x0943, 0x1eba, 0x1eb9, 0x1eb8, 0x1eb5, 0x1ebb,
+    0x1ebc, 0x1ec4, 0x1ec3, 0x1ec5, 0x060c, 0x1ec0, 0x1ec1, 0x0954,
+    0x1037, 0x1ec2, 0x0fd1, 0x1eca, 0x1ec6, 0x1ecb, 0x1ec8, 0x1ec7,
+    0x087b, 0x1ecc, 0x1ecd, 0x1ece, 0x1ec9, 0x1eb2, 0x1ecf, 0x0d5f,
+    0x1ed3, 0x1ed4, 0x1ed2, 0x1ed1, 0x1ed7, 0x1ed0, 0x1ed5, 0x1ed6,
+    0x1ed9, 0x1ed8, 0x1edb, 0x1edc, 0x1edd, 0x1168, 0x1eda, 0x0ca9,
+    0x09ab, 0x1ede, 0x1edf, 0x1ee0, 0x1ee1, 0x1ee2, 0x08b2, 0x1ee3,
+    0x1ee4, 0x0a2d, 0x1ee5, 0x1ee6, 0x1ee7, 0x1ee8, 0x1eeb, 0x1ee9,
+    0x115b, 0x1eea, 0x112d, 0x1eec, 0x1119, 0x1eed, 0x0e9e, 0x1eee,
+    0x1ef0, 0x1ef1, 0x1eef, 0x094d, 0x104b, 0x1003, 0x1435, 0x16c0,
+    0x101b, 0x0669, 0x1ef3, 0x07af, 0x1ef4, 0x1ef5, 0x1ef6, 0x0955,
+    0x1ef7, 0x17d2, 0x1059, 0x0ca1, 0x1ef8, 0x1efa, 0x1ef9, 0x1efb,
+    0x1efc, 0x1efd, 0x1efe, 0x1f00, 0x1f01, 0x1f02, 0x1f03, 0x1f04,
+    0x1f05, 0x1f06, 0x1f07, 0x1f08, 0x0d83, 0x08db, 0x1f0a, 0x0c2c,
+    0x1f0b, 0x1f0c, 0x0f00, 0x1f0d, 0x1f0e, 0x18d6, 0x1c58, 0x1deb,
+    0x1f0f, 0x1f10, 0x1f12, 0x1f13, 0x1f14, 0x112e, 0x1f11, 0x1f15,
+    0x1f16, 0x1f18, 0x1f17, 0x1f1a, 0x1f1b, 0x1f19, 0x10f4, 0x1f1c,
+    0x1f1d, 0x18f3, 0x1f1e, 0x0009, 0x0054, 0x0050, 0x0053, 0x0055,
+    0x0029, 0x002a, 0x0056, 0x003b, 0x0003, 0x0004, 0x001e, 0x00cf,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+    0x00d8, 0x0006, 0x0007, 0x0043, 0x0041, 0x0044, 0x0008, 0x0057,
+    0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+    0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+    0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+    0x00f8, 0x00f9, 0x002d, 0x001f, 0x002e, 0x000f, 0x0011, 0x000d,
+    0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108,
+    0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110,
+    0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+    0x0119, 0x011a, 0x002f, 0x0022, 0x0030, 0x0010, 0x004f,
+};
+
+#endif  // KANJI_TABLES_H_
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "batch.h"
+#include "qrender.h"
+
+// Upper bound of the quiet zone size which, like MAX_SCALE, keeps the images
+// of the largest symbols within a few GiB.
+#define MAX_QUIET_ZONE_SIZE 256
+// Upper bound of the number of threads of batch mode, each of which owns a
+// QrCode and 16 records in flight.
+#define MAX_THREADS 1024
+
+// Parses an error correction level given as one of the letters L, M, Q or H.
+static bool parseErrorCorrectionLevel(const char *str,
+                                      ErrorCorrectionLevel *level) {
+  static const char *const LEVEL_NAMES[] = {"L", "M", "Q", "H"};
+  for (int i = 0; i < 4; i++) {
+    if (strcasecmp(str, LEVEL_NAMES[i]) == 0) {
+      *level = (ErrorCorrectionLevel)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parses the name of an output format.
+static bool parseOutputFormat(const char *str, OutputFormat *format) {
+  static const char *const FORMAT_NAMES[] = {"text", "compact", "pbm",
+                                              "pgm",  "png",     "svg"};
+  for (int i = 0; i < 6; i++) {
+    if (strcasecmp(str, FORMAT_NAMES[i]) == 0) {
+      *format = (OutputFormat)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parses the name of a PNG compression.
+static bool parsePngCompression(const char *str, PngCompression *compression) {
+  static const char *const COMPRESSION_NAMES[] = {"fast", "stored"};
+  for (int i = 0; i < 2; i++) {
+    if (strcasecmp(str, COMPRESSION_NAMES[i]) == 0) {
+      *compression = (PngCompression)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parses a decimal number from min to max.
+static bool parseCount(const char *str, unsigned int min, unsigned int max,
+                       unsigned int *count) {
+  char *end;
+  long value = strtol(str, &end, 10);
+  if (*str == '\0' || *end != '\0' || value < (long)min ||
+      value > (long)max) {
+    return false;
+  }
+  *count = (unsigned int)value;
+  return true;
+}
+
+static void printUsage(const char *program) {
+  fprintf(stderr,
+          "Usage: %s [options] [string]\n"
+          "\n"
+          "Without -b, encodes string in a single QR Code.\n"
+          "\n"
+          "Options:\n"
+          "  -e LEVEL  Error correction level: L, M, Q or H (default: L).\n"
+          "  -f FORMAT Output format: text, compact for half-block text\n"
+          "            with two rows of modules per line, or pbm, pgm, png\n"
+          "            or svg for images (default: text).\n"
+          "  -s SCALE  Side of a module in pixels in images (default: 1).\n"
+          "  -c METHOD PNG compression: fast, or stored for none (default:\n"
+          "            fast).\n"
+          "  -q SIZE   Size of the quiet zone in modules (default: 5). Below\n"
+          "            4, some readers may not find the symbol.\n"
+          "  -b        Batch mode: encode one QR Code per record read from\n"
+          "            stdin.\n"
+          "  -i FILE   Read the batch records from FILE (implies -b).\n"
+          "  -d CHAR   Record separator used in batch mode for both input and\n"
+          "            output (default: newline; implies -b).\n"
+          "  -0        Use NUL as record separator (implies -b).\n"
+          "  -j N      Number of threads used in batch mode, up to 1024\n"
+          "            (default: one per online CPU).\n",
+          program);
+}
+
+int main(int argc, char *argv[]) {
+  bool batchMode = false;
+  const char *inputPath = NULL;
+  int separator = '\n';
+  long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned int numThreads = numCpus < 1             ? 1
+                            : numCpus > MAX_THREADS ? MAX_THREADS
+                                                    : (unsigned int)numCpus;
+  ErrorCorrectionLevel errorCorrectionLevel = ERROR_CORRECTION_LEVEL_L;
+  RenderOptions renderOptions = {
+      .format = OUTPUT_FORMAT_TEXT,
+      .quietZoneSize = QUIET_ZONE_SIZE,
+      .scale = 1,
+  };
+
+  int option;
+  while ((option = getopt(argc, argv, "e:f:s:c:q:bi:d:0j:")) != -1) {
+    switch (option) {
+      case 'e':
+        if (!parseErrorCorrectionLevel(optarg, &errorCorrectionLevel)) {
+          fprintf(stderr, "Unknown error correction level: %s\n", optarg);
+          return 1;
+        }
+        break;
+      case 'f':
+        if (!parseOutputFormat(optarg, &renderOptions.format)) {
+          fprintf(stderr, "Unknown output format: %s\n", optarg);
+          return 1;
+        }
+        break;
+      case 's':
+        if (!parseCount(optarg, 1, MAX_SCALE, &renderOptions.scale)) {
+          fprintf(stderr, "The scale must be a number from 1 to %d\n",
+                  MAX_SCALE);
+          return 1;
+        }
+        break;
+      case 'c':
+        if (!parsePngCompression(optarg, &renderOptions.pngCompression)) {
+          fprintf(stderr, "Unknown PNG compression: %s\n", optarg);
+          return 1;
+        }
+        break;
+      case 'q':
+        if (!parseCount(optarg, 0, MAX_QUIET_ZONE_SIZE,
+                        &renderOptions.quietZoneSize)) {
+          fprintf(stderr,
+                  "The quiet zone size must be a number from 0 to %d\n",
+                  MAX_QUIET_ZONE_SIZE);
+          return 1;
+        }
+        break;
+      case 'b':
+        batchMode = true;
+        break;
+      case 'i':
+        batchMode = true;
+        inputPath = optarg;
+        break;
+      case 'd':
+        if (strlen(optarg) != 1) {
+          fprintf(stderr, "The record separator must be a single character\n");
+          return 1;
+        }
+        batchMode = true;
+        separator = (unsigned char)optarg[0];
+        break;
+      case '0':
+        batchMode = true;
+        separator = '\0';
+        break;
+      case 'j':
+        if (!parseCount(optarg, 1, MAX_THREADS, &numThreads)) {
+          fprintf(stderr,
+                  "The number of threads must be a number from 1 to %d\n",
+                  MAX_THREADS);
+          return 1;
+        }
+        break;
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if (batchMode) {
+    FILE *in = stdin;
+    if (inputPath != NULL && (in = fopen(inputPath, "rb")) == NULL) {
+      perror(inputPath);
+      return 1;
+    }
+    bool allEncoded =
+        runBatch(in, stdout, separator, errorCorrectionLevel, &renderOptions,
+                 numThreads);
+    if (in != stdin) {
+      fclose(in);
+    }
+    return allEncoded ? 0 : 1;
+  }
+
+  if (optind >= argc) {
+    printf("Supply a string to be encoded in the QR Code\n");
+    return 1;
+  }
+
+  QrCode qrcode;
+  const char *input = argv[optind];
+  if (!encodeQrCode(&qrcode, (const unsigned char *)input, strlen(input),
+                    errorCorrectionLevel)) {
+    return 1;
+  }
+
+  if (!render(&qrcode, &renderOptions, stdout)) {
+    fprintf(stderr, "Could not write the QR Code\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "png.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "png_tables.h"
+
+static const unsigned char PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G',
+                                              '\r', '\n', 0x1a, '\n'};
+#define PNG_SIGNATURE_LENGTH sizeof(PNG_SIGNATURE)
+// Length, type and CRC of a chunk.
+#define PNG_CHUNK_OVERHEAD 12
+// Length and type of a chunk, before its data.
+#define PNG_CHUNK_HEADER_LENGTH 8
+// Longest data of a chunk, see 5.3 of the PNG specification.
+#define PNG_MAX_CHUNK_LENGTH 0x7fffffff
+#define PNG_IHDR_LENGTH 13
+// Deflate with a 32 KiB window, no preset dictionary, see RFC 1950.
+static const unsigned char ZLIB_HEADER[] = {0x78, 0x01};
+#define ZLIB_HEADER_LENGTH sizeof(ZLIB_HEADER)
+#define ZLIB_CHECKSUM_LENGTH 4
+
+#define ADLER_MODULUS 65521
+// Largest number of bytes that can be added to an Adler-32 checksum before
+// its sums could overflow 32 bits.
+#define ADLER_BLOCK_SIZE 5552
+
+// Longest stored block.
+#define DEFLATE_STORED_BLOCK_SIZE 65535
+// Header byte and the two 16-bit lengths of a stored block.
+#define DEFLATE_STORED_BLOCK_OVERHEAD 5
+// Farthest distance a match can reach back.
+#define DEFLATE_WINDOW_SIZE 32768
+#define DEFLATE_MIN_MATCH_LENGTH 3
+// Matches of the previous scanline have longer distance codes: below this
+// length, they could take more bits than the literals they stand for.
+#define DEFLATE_MIN_ROW_MATCH_LENGTH 4
+// Largest number of bits of a literal, which bounds the size of a block.
+#define DEFLATE_MAX_LITERAL_BITS 9
+// Header of a block and its end of block code.
+#define DEFLATE_BLOCK_OVERHEAD_BITS (3 + 7)
+
+// Checksums ------------------------------------------------------------------
+
+static inline uint32_t readLittleEndian32(const unsigned char *data) {
+  return (uint32_t)data[0] | (uint32_t)data[1] << 8 |
+         (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+uint32_t updateCrc32(uint32_t crc, const unsigned char *data, size_t length) {
+  crc = ~crc;
+  // Slice-by-8: the next 8 bytes are folded into the CRC at once, each one
+  // through the table matching its distance from the end of the word.
+  for (; length >= 8; data += 8, length -= 8) {
+    uint32_t low = crc ^ readLittleEndian32(data);
+    uint32_t high = readLittleEndian32(data + 4);
+    crc = pngCrcTables[7][low & 0xff] ^ pngCrcTables[6][(low >> 8) & 0xff] ^
+          pngCrcTables[5][(low >> 16) & 0xff] ^ pngCrcTables[4][low >> 24] ^
+          pngCrcTables[3][high & 0xff] ^ pngCrcTables[2][(high >> 8) & 0xff] ^
+          pngCrcTables[1][(high >> 16) & 0xff] ^ pngCrcTables[0][high >> 24];
+  }
+  for (; length > 0; data++, length--) {
+    crc = (crc >> 8) ^ pngCrcTables[0][(crc ^ *data) & 0xff];
+  }
+  return ~crc;
+}
+
+uint32_t updateAdler32(uint32_t adler, const unsigned char *data,
+                       size_t length) {
+  uint32_t a = adler & 0xffff;
+  uint32_t b = adler >> 16;
+  // The modulo is only taken once per block of bytes.
+  while (length > 0) {
+    size_t blockLength = length < ADLER_BLOCK_SIZE ? length : ADLER_BLOCK_SIZE;
+    length -= blockLength;
+    for (; blockLength >= 8; data += 8, blockLength -= 8) {
+      a += data[0];
+      b += a;
+      a += data[1];
+      b += a;
+      a += data[2];
+      b += a;
+      a += data[3];
+      b += a;
+      a += data[4];
+      b += a;
+      a += data[5];
+      b += a;
+      a += data[6];
+      b += a;
+      a += data[7];
+      b += a;
+    }
+    for (; blockLength > 0; data++, blockLength--) {
+      a += *data;
+      b += a;
+    }
+    a %= ADLER_MODULUS;
+    b %= ADLER_MODULUS;
+  }
+  return b << 16 | a;
+}
+
+// Checksums ------------------------------------------------------------------
+
+// Deflate --------------------------------------------------------------------
+
+// Writes Deflate codes, least significant bit first.
+typedef struct {
+  unsigned char *out;
+  uint64_t bits;
+  unsigned int numBits;
+} BitWriter;
+
+// Appends the given number of bits (at most 32) of bits.
+static inline void writeBits(BitWriter *writer, uint32_t bits,
+                             unsigned int length) {
+  writer->bits |= (uint64_t)bits << writer->numBits;
+  writer->numBits += length;
+  if (writer->numBits >= 32) {
+    for (int i = 0; i < 4; i++) {
+      *writer->out++ = (unsigned char)(writer->bits >> (8 * i));
+    }
+    writer->bits >>= 32;
+    writer->numBits -= 32;
+  }
+}
+
+// Writes the bits left, padded to a whole byte, and returns their end.
+static unsigned char *flushBits(BitWriter *writer) {
+  for (; writer->numBits > 0; writer->bits >>= 8) {
+    *writer->out++ = (unsigned char)writer->bits;
+    writer->numBits = writer->numBits > 8 ? writer->numBits - 8 : 0;
+  }
+  return writer->out;
+}
+
+// Returns the number of bytes, up to maxLength, that data[position] starts
+// in common with data[position - distance]. The two may overlap.
+static size_t getMatchLength(const unsigned char *data, size_t position,
+                             size_t distance, size_t maxLength) {
+  const unsigned char *current = data + position;
+  const unsigned char *previous = current - distance;
+  size_t length = 0;
+  for (; length + 8 <= maxLength; length += 8) {
+    uint64_t currentWord, previousWord;
+    memcpy(&currentWord, current + length, 8);
+    memcpy(&previousWord, previous + length, 8);
+    if (currentWord != previousWord) {
+      break;
+    }
+  }
+  while (length < maxLength && current[length] == previous[length]) {
+    length++;
+  }
+  return length;
+}
+
+static void writeDistance(BitWriter *writer, size_t distance) {
+  unsigned int symbol = 0;
+  while (symbol + 1 < sizeof(deflateDistanceBases) / sizeof(uint16_t) &&
+         deflateDistanceBases[symbol + 1] <= distance) {
+    symbol++;
+  }
+  // The 5-bit code is written most significant bit first.
+  uint32_t code = 0;
+  for (int i = 0; i < 5; i++) {
+    code |= ((symbol >> i) & 1) << (4 - i);
+  }
+  writeBits(writer, code, 5);
+  writeBits(writer, (uint32_t)(distance - deflateDistanceBases[symbol]),
+            deflateDistanceExtraBits[symbol]);
+}
+
+// Compresses data, made of scanlines of stride bytes, into a single block of
+// fixed Huffman codes. At every position, the longest of a run of the
+// previous byte and a copy of the previous scanline becomes a match, if long
+// enough. Returns the end of the block.
+static unsigned char *deflateFast(const unsigned char *data, size_t length,
+                                  size_t stride, unsigned char *out) {
+  BitWriter writer = {out, 0, 0};
+  // Final block (1) of fixed Huffman codes (01).
+  writeBits(&writer, 0b011, 3);
+  bool canMatchRow = stride <= DEFLATE_WINDOW_SIZE;
+  size_t position = 0;
+  while (position < length) {
+    size_t maxLength = length - position < DEFLATE_MAX_MATCH_LENGTH
+                           ? length - position
+                           : DEFLATE_MAX_MATCH_LENGTH;
+    size_t runLength =
+        position > 0 ? getMatchLength(data, position, 1, maxLength) : 0;
+    size_t rowLength = canMatchRow && position >= stride
+                           ? getMatchLength(data, position, stride, maxLength)
+                           : 0;
+    if (rowLength >= DEFLATE_MIN_ROW_MATCH_LENGTH && rowLength > runLength) {
+      writeBits(&writer, deflateLengthCodes[rowLength].bits,
+                deflateLengthCodes[rowLength].length);
+      writeDistance(&writer, stride);
+      position += rowLength;
+    } else if (runLength >= DEFLATE_MIN_MATCH_LENGTH) {
+      writeBits(&writer, deflateLengthCodes[runLength].bits,
+                deflateLengthCodes[runLength].length);
+      writeDistance(&writer, 1);
+      position += runLength;
+    } else {
+      writeBits(&writer, deflateLiteralCodes[data[position]].bits,
+                deflateLiteralCodes[data[position]].length);
+      position++;
+    }
+  }
+  // End of block.
+  writeBits(&writer, 0, 7);
+  return flushBits(&writer);
+}
+
+// Copies data into stored blocks and returns their end.
+static unsigned char *deflateStored(const unsigned char *data, size_t length,
+                                    unsigned char *out) {
+  do {
+    size_t blockLength = length < DEFLATE_STORED_BLOCK_SIZE
+                             ? length
+                             : DEFLATE_STORED_BLOCK_SIZE;
+    length -= blockLength;
+    // Final block flag, then the stored block type (00).
+    *out++ = length == 0;
+    *out++ = (unsigned char)blockLength;
+    *out++ = (unsigned char)(blockLength >> 8);
+    *out++ = (unsigned char)~blockLength;
+    *out++ = (unsigned char)(~blockLength >> 8);
+    memcpy(out, data, blockLength);
+    out += blockLength;
+    data += blockLength;
+  } while (length > 0);
+  return out;
+}
+
+static size_t getDeflateMaxSize(size_t length, PngCompression compression) {
+  if (compression == PNG_COMPRESSION_STORED) {
+    size_t numBlocks =
+        length == 0 ? 1
+                    : (length + DEFLATE_STORED_BLOCK_SIZE - 1) /
+                          DEFLATE_STORED_BLOCK_SIZE;
+    return length + numBlocks * DEFLATE_STORED_BLOCK_OVERHEAD;
+  }
+  // No match takes more bits than the literals it replaces.
+  return (length * DEFLATE_MAX_LITERAL_BITS + DEFLATE_BLOCK_OVERHEAD_BITS +
+          7) /
+         8;
+}
+
+// Deflate --------------------------------------------------------------------
+
+// PNG ------------------------------------------------------------------------
+
+static inline unsigned char *writeBigEndian32(unsigned char *out,
+                                              uint32_t value) {
+  *out++ = (unsigned char)(value >> 24);
+  *out++ = (unsigned char)(value >> 16);
+  *out++ = (unsigned char)(value >> 8);
+  *out++ = (unsigned char)value;
+  return out;
+}
+
+// Writes the length and type of a chunk and returns the start of its data.
+static unsigned char *writeChunkHeader(unsigned char *out, const char *type,
+                                       uint32_t length) {
+  out = writeBigEndian32(out, length);
+  memcpy(out, type, 4);
+  return out + 4;
+}
+
+// Writes the CRC of the chunk starting at chunk, whose data ends at end, and
+// returns the end of the chunk.
+static unsigned char *writeChunkCrc(unsigned char *chunk, unsigned char *end) {
+  // The CRC covers the type and the data, but not the length.
+  return writeBigEndian32(end, updateCrc32(0, chunk + 4, end - chunk - 4));
+}
+
+// Returns the number of IDAT chunks holding a zlib stream of the given
+// length: at least one, even if the stream could be empty.
+static size_t getNumIdatChunks(size_t zlibLength) {
+  return zlibLength == 0
+             ? 1
+             : (zlibLength + PNG_MAX_CHUNK_LENGTH - 1) / PNG_MAX_CHUNK_LENGTH;
+}
+
+size_t getPngScanlinesSize(uint32_t width, uint32_t height) {
+  return (size_t)height * (1 + ((size_t)width + 7) / 8);
+}
+
+size_t getPngMaxSize(uint32_t width, uint32_t height,
+                     PngCompression compression) {
+  size_t zlibMaxLength =
+      ZLIB_HEADER_LENGTH +
+      getDeflateMaxSize(getPngScanlinesSize(width, height), compression) +
+      ZLIB_CHECKSUM_LENGTH;
+  return PNG_SIGNATURE_LENGTH + PNG_CHUNK_OVERHEAD + PNG_IHDR_LENGTH +
+         getNumIdatChunks(zlibMaxLength) * PNG_CHUNK_OVERHEAD +
+         zlibMaxLength + PNG_CHUNK_OVERHEAD;
+}
+
+size_t writePng(const unsigned char *scanlines, uint32_t width,
+                uint32_t height, PngCompression compression,
+                unsigned char *buffer) {
+  size_t scanlinesSize = getPngScanlinesSize(width, height);
+  memcpy(buffer, PNG_SIGNATURE, PNG_SIGNATURE_LENGTH);
+  unsigned char *out = buffer + PNG_SIGNATURE_LENGTH;
+
+  unsigned char *chunk = out;
+  out = writeChunkHeader(out, "IHDR", PNG_IHDR_LENGTH);
+  out = writeBigEndian32(out, width);
+  out = writeBigEndian32(out, height);
+  *out++ = 1;  // Bit depth.
+  *out++ = 0;  // Color type: grayscale.
+  *out++ = 0;  // Compression method: Deflate.
+  *out++ = 0;  // Filter method: adaptive, with a filter type per scanline.
+  *out++ = 0;  // Interlace method: none.
+  out = writeChunkCrc(chunk, out);
+
+  // The zlib stream is written as the data of a single IDAT chunk, whose
+  // length is only known once it is compressed. Streams longer than a chunk
+  // can hold are then split, the data of every chunk moved past the headers
+  // and CRCs of the chunks before it, starting from the last one.
+  unsigned char *data = out + PNG_CHUNK_HEADER_LENGTH;
+  memcpy(data, ZLIB_HEADER, ZLIB_HEADER_LENGTH);
+  unsigned char *end = data + ZLIB_HEADER_LENGTH;
+  end = compression == PNG_COMPRESSION_STORED
+            ? deflateStored(scanlines, scanlinesSize, end)
+            : deflateFast(scanlines, scanlinesSize, 1 + ((size_t)width + 7) / 8,
+                          end);
+  end = writeBigEndian32(end, updateAdler32(1, scanlines, scanlinesSize));
+  size_t zlibLength = end - data;
+  size_t numChunks = getNumIdatChunks(zlibLength);
+  for (size_t i = numChunks; i-- > 0;) {
+    size_t start = i * PNG_MAX_CHUNK_LENGTH;
+    size_t length = zlibLength - start < PNG_MAX_CHUNK_LENGTH
+                        ? zlibLength - start
+                        : PNG_MAX_CHUNK_LENGTH;
+    chunk = out + start + i * PNG_CHUNK_OVERHEAD;
+    memmove(chunk + PNG_CHUNK_HEADER_LENGTH, data + start, length);
+    writeChunkCrc(chunk,
+                  writeChunkHeader(chunk, "IDAT", (uint32_t)length) + length);
+  }
+  out += zlibLength + numChunks * PNG_CHUNK_OVERHEAD;
+
+  chunk = out;
+  out = writeChunkCrc(chunk, writeChunkHeader(out, "IEND", 0));
+  return out - buffer;
+}
+
+// PNG ------------------------------------------------------------------------
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PNG_H_
+#define PNG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Ways of compressing the image data of a PNG. */
+typedef enum {
+  // A single Deflate block of fixed Huffman codes, where runs of a byte and
+  // copies of the previous scanline become matches. Made for the long runs of
+  // identical pixels and rows of scaled QR Codes. This is the default.
+  PNG_COMPRESSION_FAST,
+  // Stored Deflate blocks: the image data is copied as is.
+  PNG_COMPRESSION_STORED,
+} PngCompression;
+
+/** Returns the size of the scanlines of a 1-bit image: height rows of a
+ * filter type byte followed by (width + 7) / 8 bytes of pixels.
+ */
+size_t getPngScanlinesSize(uint32_t width, uint32_t height);
+
+/** Returns the number of bytes writePng may write for an image of the given
+ * size.
+ */
+size_t getPngMaxSize(uint32_t width, uint32_t height,
+                     PngCompression compression);
+
+/** Writes a 1-bit grayscale PNG of the given scanlines into buffer, which
+ * must hold at least getPngMaxSize bytes. Every scanline is a filter type
+ * byte, which must be 0 (no filter), followed by the pixels of a row, the
+ * leftmost in the most significant bit. 0 is black and 1 is white. The
+ * image data is split into IDAT chunks of at most 2^31 - 1 bytes. Returns the
+ * number of bytes written. Does not allocate.
+ */
+size_t writePng(const unsigned char *scanlines, uint32_t width,
+                uint32_t height, PngCompression compression,
+                unsigned char *buffer);
+
+/** Updates a CRC-32, as used by PNG chunks and starting from 0, with the
+ * length bytes of data.
+ */
+uint32_t updateCrc32(uint32_t crc, const unsigned char *data, size_t length);
+
+/** Updates an Adler-32 checksum, as used by zlib and starting from 1, with the
+ * length bytes of data.
+ */
+uint32_t updateAdler32(uint32_t adler, const unsigned char *data,
+                       size_t length);
+
+#endif  // PNG_H_
@@ -14,31 +14,78 @@
  * limitations under the License.
  */
 
+#include "qrender.h"
+
+#include <pthread.h>
+#include <limits.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define VERSION 1
-#define VERSION_1_SIDE_LENGTH 21
-#define FINDER_PATTERN_SIZE_LENGTH 7
-#define ENCODING_MODE_INDICATOR_BYTE 0b0100
-#define QUIET_ZONE_SIZE 5
-
-// Error Correction Level L (Low).
-#define ERROR_CORRECTION_LEVEL 0b01
-// Mask Pattern 0.
-#define MASK_PATTERN_REFERENCE 0b000
-#define COMBINED_FORMAT_INFORMATION 0b1111010110
-#define FIXED_MASK_PATTERN 0b101010000010010
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
 
-// See Table C.1
-const unsigned short MASKED_FORMAT_INFORMATION = 0b111011111000100;
+#include "gf_tables.h"
+#include "kanji_tables.h"
 
-const char *MODULE_WHITE = "  ";
-const char *MODULE_BLACK = "██";
+#define FINDER_PATTERN_SIZE_LENGTH 7
 
-const bool finderPattern[FINDER_PATTERN_SIZE_LENGTH]
+// Encoding modes, see 7.3.
+typedef enum {
+  ENCODING_MODE_NUMERIC,
+  ENCODING_MODE_ALPHANUMERIC,
+  ENCODING_MODE_BYTE,
+  ENCODING_MODE_KANJI,
+  NUM_ENCODING_MODES,
+} EncodingMode;
+
+// Mode indicators, see Table 2.
+static const unsigned char ENCODING_MODE_INDICATORS[NUM_ENCODING_MODES] = {
+    0b0001,  // Numeric.
+    0b0010,  // Alphanumeric.
+    0b0100,  // Byte.
+    0b1000,  // Kanji.
+};
+
+// Values of the 45 characters of alphanumeric mode (digits, uppercase
+// letters, space and $%*+-./:), see Table 5, and -1 for the other bytes.
+static const signed char ALPHANUMERIC_VALUES[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    36, -1, -1, -1, 37, 38, -1, -1, -1, -1, 39, 40, -1, 41, 42, 43,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 44, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+// Longest string that fits in a symbol: 7089 digits, in a Version 40 symbol
+// at error correction level L.
+#define MAX_STRING_LENGTH 7089
+
+#define NUM_MASK_PATTERNS 8
+#define FORMAT_INFORMATION_GENERATOR 0b10100110111
+#define FORMAT_INFORMATION_MASK 0b101010000010010
+
+static const char MODULE_WHITE[] = "  ";
+static const char MODULE_BLACK[] = "██";
+#define MODULE_WHITE_LENGTH (sizeof(MODULE_WHITE) - 1)
+#define MODULE_BLACK_LENGTH (sizeof(MODULE_BLACK) - 1)
+
+static const bool finderPattern[FINDER_PATTERN_SIZE_LENGTH]
                         [FINDER_PATTERN_SIZE_LENGTH] = {
                             {true, true, true, true, true, true, true},
                             {true, false, false, false, false, false, true},
@@ -48,97 +95,344 @@ const bool finderPattern[FINDER_PATTERN_SIZE_LENGTH]
                             {true, false, false, false, false, false, true},
                             {true, true, true, true, true, true, true}};
 
-bool qrcode[VERSION_1_SIDE_LENGTH][VERSION_1_SIDE_LENGTH];
-
 // Galois Field ---------------------------------------------------------------
 
-// As defined by the QrCode standard for V1.
+// The exponential and logarithm tables for GF(256), with the primitive
+// polynomial x^8 + x^4 + x^3 + x^2 + 1 defined by the QrCode standard, are
+// generated ahead of time by tools/gen_gf_tables.py. Being constant, they need
+// no initialization and can be read from any number of threads.
 #define GF_SIZE 256
-#define GF_PRIMITIVE_POLY 0b100011101  // x^8 + x^4 + x^3 + x^2 + 1
 
-unsigned char gfExpLookupTable[GF_SIZE];
-unsigned char gfLogLookupTable[GF_SIZE];
+static inline unsigned char gfAdd(unsigned char a, unsigned char b) {
+  return a ^ b;
+}
 
-void initGfLookupTables() {
-  unsigned short x = 1;  // Using short to detect overflows.
+static inline unsigned char gfSub(unsigned char a, unsigned char b) {
+  return gfAdd(a, b);
+}
 
-  // Generate the exponential table
-  for (unsigned int i = 0; i < GF_SIZE - 1; i++) {
-    gfExpLookupTable[i] = (unsigned char)x;
-    gfLogLookupTable[(unsigned char)x] = i;
+// Branch-free: the product is computed unconditionally and then masked to 0
+// when either operand is 0 (whose logarithm is undefined).
+static inline unsigned char gfMul(unsigned char a, unsigned char b) {
+  // Remember: a * b = exp(log(a) + log(b)). The exponential table is stored
+  // twice, so the sum does not need to be reduced modulo 255.
+  unsigned char product =
+      gfExpLookupTable[gfLogLookupTable[a] + gfLogLookupTable[b]];
+  return product & (unsigned char)-((a != 0) & (b != 0));
+}
+
+static inline unsigned char gfDiv(unsigned char a, unsigned char b) {
+  if (b == 0) {
+    fprintf(stderr, "Error: Division by zero in Galois Field\n");
+    return 0;
+  }
+
+  if (a == 0) {
+    return 0;
+  }
+
+  // Remember: a / b = exp(log(a) - log(b)) = exp(log(a) + 255 - log(b))
+  return gfExpLookupTable[gfLogLookupTable[a] + (GF_SIZE - 1) -
+                          gfLogLookupTable[b]];
+}
+// Galois Field ---------------------------------------------------------------
+
+// Reed-Solomon implementation ------------------------------------------------
+
+// The generator polynomials of every degree up to
+// MAX_GENERATOR_POLYNOMIAL_DEGREE (see Annex A) are generated ahead of time
+// into gfGeneratorPolynomials, next to the GF(256) tables.
+
+// Row stride of the generator rows, enough for the coefficients of the
+// largest generator polynomial.
+#define GENERATOR_ROW_SIZE (MAX_GENERATOR_POLYNOMIAL_DEGREE + 2)
+
+static GfMulBackend gfMulBackend = GF_MUL_SPLIT_NIBBLE;
+
+// Backing tables of GF_MUL_PRODUCT_TABLE and GF_MUL_GENERATOR_ROWS. Built on
+// first use, as they are too large to be worth generating ahead of time.
+static unsigned char gfProductTable[GF_SIZE][GF_SIZE];
+static pthread_once_t gfProductTableOnce = PTHREAD_ONCE_INIT;
+// generatorRows[n][f][j] is f times the coefficient of x^(n - j) in the
+// generator polynomial of degree n. Only the degrees actually used are built.
+static unsigned char generatorRows[MAX_GENERATOR_POLYNOMIAL_DEGREE + 1]
+                                  [GF_SIZE][GENERATOR_ROW_SIZE];
+static atomic_bool generatorRowsReady[MAX_GENERATOR_POLYNOMIAL_DEGREE + 1];
+static pthread_mutex_t generatorRowsLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void initGfProductTable(void) {
+  for (unsigned int a = 0; a < GF_SIZE; a++) {
+    for (unsigned int b = 0; b < GF_SIZE; b++) {
+      gfProductTable[a][b] = gfMul(a, b);
+    }
+  }
+}
+
+static const unsigned char (*getGeneratorRows(unsigned int degree))
+    [GENERATOR_ROW_SIZE] {
+  if (!atomic_load_explicit(&generatorRowsReady[degree],
+                            memory_order_acquire)) {
+    pthread_mutex_lock(&generatorRowsLock);
+    if (!atomic_load_explicit(&generatorRowsReady[degree],
+                              memory_order_relaxed)) {
+      for (unsigned int factor = 0; factor < GF_SIZE; factor++) {
+        for (unsigned int j = 0; j <= degree; j++) {
+          generatorRows[degree][factor][j] =
+              gfMul(factor, gfGeneratorPolynomials[degree][j]);
+        }
+      }
+      atomic_store_explicit(&generatorRowsReady[degree], true,
+                            memory_order_release);
+    }
+    pthread_mutex_unlock(&generatorRowsLock);
+  }
+  return (const unsigned char (*)[GENERATOR_ROW_SIZE])generatorRows[degree];
+}
 
-    // In GF(256) arithmetic, multiplying elements means performing polynomial
-    // multiplication modulo the primitive polynomial.
-    // Think of x as a representation of a polynomial. Shifting it left by one
-    // effectively multiplies the polynomial by itself. Let's say
-    // (hypothetically) that at some point in the loop, x is 5 (which represents
-    // x^2 + 1). Then x << 1 will result in 10, which represents x^3 + x, which
-    // is equivalent to x * (x^2 + 1) = x^3 + x.
-    x = x << 1;
-    if (x >= GF_SIZE) {
-      x = x ^ GF_PRIMITIVE_POLY;
+// Each of the following divides the polynomial made of the numDataCodewords
+// data codewords by the generator polynomial of the given degree in GF(256),
+// and writes the remainder (the error correction codewords) in the degree
+// bytes right after them. The data codewords are left untouched.
+//
+// The division runs as a linear feedback shift register over the remainder:
+// remainder = (remainder << 1) ^ (data ^ remainder[0]) * generator. The
+// implementations only differ in how the products of the feedback factor and
+// the generator coefficients are computed.
+
+static void dividePolynomialLogExp(unsigned char *codewords,
+                                   size_t numDataCodewords,
+                                   unsigned int degree) {
+  const unsigned char *generatorPolynomialCoefficients =
+      gfGeneratorPolynomials[degree];
+  unsigned char *remainder = codewords + numDataCodewords;
+  memset(remainder, 0, degree);
+
+  for (size_t i = 0; i < numDataCodewords; i++) {
+    unsigned char factor = gfSub(codewords[i], remainder[0]);
+    for (unsigned int j = 0; j + 1 < degree; j++) {
+      remainder[j] =
+          gfSub(remainder[j + 1],
+                gfMul(factor, generatorPolynomialCoefficients[j + 1]));
     }
+    remainder[degree - 1] =
+        gfMul(factor, generatorPolynomialCoefficients[degree]);
+  }
+}
+
+static void dividePolynomialProductTable(unsigned char *codewords,
+                                         size_t numDataCodewords,
+                                         unsigned int degree) {
+  const unsigned char
+      *generatorProductRows[MAX_GENERATOR_POLYNOMIAL_DEGREE + 1];
+  for (unsigned int j = 0; j <= degree; j++) {
+    generatorProductRows[j] = gfProductTable[gfGeneratorPolynomials[degree][j]];
   }
+  unsigned char *remainder = codewords + numDataCodewords;
+  memset(remainder, 0, degree);
 
-  // For expTable to be useful in multiplication, we need to make it circular
-  // so that we can compute α^(i+j) easily when i+j ≥ 255
-  gfExpLookupTable[GF_SIZE - 1] = gfExpLookupTable[0];  // α^255 = α^0 = 1
-  gfLogLookupTable[0] = 0;  // Handle special case for logarithm of 0.
+  for (size_t i = 0; i < numDataCodewords; i++) {
+    unsigned char factor = codewords[i] ^ remainder[0];
+    for (unsigned int j = 0; j + 1 < degree; j++) {
+      remainder[j] = remainder[j + 1] ^ generatorProductRows[j + 1][factor];
+    }
+    remainder[degree - 1] = generatorProductRows[degree][factor];
+  }
 }
 
-unsigned char gfAdd(unsigned char a, unsigned char b) { return a ^ b; }
+static void dividePolynomialGeneratorRows(unsigned char *codewords,
+                                          size_t numDataCodewords,
+                                          unsigned int degree) {
+  const unsigned char(*rows)[GENERATOR_ROW_SIZE] = getGeneratorRows(degree);
+  unsigned char *remainder = codewords + numDataCodewords;
+  memset(remainder, 0, degree);
+
+  for (size_t i = 0; i < numDataCodewords; i++) {
+    const unsigned char *products = rows[codewords[i] ^ remainder[0]];
+    for (unsigned int j = 0; j + 1 < degree; j++) {
+      remainder[j] = remainder[j + 1] ^ products[j + 1];
+    }
+    remainder[degree - 1] = products[degree];
+  }
+}
 
-unsigned char gfSub(unsigned char a, unsigned char b) { return gfAdd(a, b); }
+// Split-nibble multiplication: f * x = f * (x & 0xf) ^ f * (x & 0xf0), and
+// gfNibbleProductTable holds both halves as 16-byte tables for every f. With
+// the generator coefficients split in nibbles once, a pair of pshufb computes
+// the products of f with all of them at the same time, and the whole
+// remainder is kept and shifted in vector registers.
+
+// Wide enough for the largest remainder, MAX_GENERATOR_POLYNOMIAL_DEGREE.
+#define SIMD_REMAINDER_SIZE 32
+
+// Lowest-degree coefficients last and padded with zeros: the coefficient of
+// x^(degree - 1 - j) is at index j, the leading 1 is left out.
+static void fillSimdGeneratorCoefficients(
+    unsigned char coefficients[SIMD_REMAINDER_SIZE], unsigned int degree) {
+  memset(coefficients, 0, SIMD_REMAINDER_SIZE);
+  memcpy(coefficients, gfGeneratorPolynomials[degree] + 1, degree);
+}
 
-unsigned char gfMul(unsigned char a, unsigned char b) {
-  if (a == 0 || b == 0) {
-    return 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD 1
+
+__attribute__((target("ssse3"))) static void dividePolynomialSsse3(
+    unsigned char *codewords, size_t numDataCodewords, unsigned int degree) {
+  unsigned char coefficients[SIMD_REMAINDER_SIZE];
+  fillSimdGeneratorCoefficients(coefficients, degree);
+
+  const __m128i lowNibbleMask = _mm_set1_epi8(0x0f);
+  __m128i coefficientsLow = _mm_loadu_si128((const __m128i *)coefficients);
+  __m128i coefficientsHigh =
+      _mm_loadu_si128((const __m128i *)(coefficients + 16));
+  __m128i lowNibblesLow = _mm_and_si128(coefficientsLow, lowNibbleMask);
+  __m128i highNibblesLow =
+      _mm_and_si128(_mm_srli_epi16(coefficientsLow, 4), lowNibbleMask);
+  __m128i lowNibblesHigh = _mm_and_si128(coefficientsHigh, lowNibbleMask);
+  __m128i highNibblesHigh =
+      _mm_and_si128(_mm_srli_epi16(coefficientsHigh, 4), lowNibbleMask);
+
+  // Bytes 0-15 and 16-31 of the remainder.
+  __m128i remainderLow = _mm_setzero_si128();
+  __m128i remainderHigh = _mm_setzero_si128();
+  for (size_t i = 0; i < numDataCodewords; i++) {
+    unsigned char factor =
+        codewords[i] ^ (unsigned char)_mm_cvtsi128_si32(remainderLow);
+    const __m128i *products = (const __m128i *)gfNibbleProductTable[factor];
+    __m128i lowNibbleProducts = _mm_loadu_si128(products);
+    __m128i highNibbleProducts = _mm_loadu_si128(products + 1);
+
+    remainderLow = _mm_alignr_epi8(remainderHigh, remainderLow, 1);
+    remainderHigh = _mm_srli_si128(remainderHigh, 1);
+
+    remainderLow = _mm_xor_si128(
+        remainderLow,
+        _mm_xor_si128(_mm_shuffle_epi8(lowNibbleProducts, lowNibblesLow),
+                      _mm_shuffle_epi8(highNibbleProducts, highNibblesLow)));
+    remainderHigh = _mm_xor_si128(
+        remainderHigh,
+        _mm_xor_si128(_mm_shuffle_epi8(lowNibbleProducts, lowNibblesHigh),
+                      _mm_shuffle_epi8(highNibbleProducts, highNibblesHigh)));
   }
 
-  // Remember: a * b = exp(log(a) + log(b))
-  int logSum = gfLogLookupTable[a] + gfLogLookupTable[b];
-  return gfExpLookupTable[logSum % (GF_SIZE - 1)];
+  unsigned char remainder[SIMD_REMAINDER_SIZE];
+  _mm_storeu_si128((__m128i *)remainder, remainderLow);
+  _mm_storeu_si128((__m128i *)(remainder + 16), remainderHigh);
+  memcpy(codewords + numDataCodewords, remainder, degree);
 }
 
-unsigned char gfDiv(unsigned char a, unsigned char b) {
-  if (b == 0) {
-    fprintf(stderr, "Error: Division by zero in Galois Field\n");
-    return 0;
+__attribute__((target("avx2"))) static void dividePolynomialAvx2(
+    unsigned char *codewords, size_t numDataCodewords, unsigned int degree) {
+  unsigned char coefficients[SIMD_REMAINDER_SIZE];
+  fillSimdGeneratorCoefficients(coefficients, degree);
+
+  const __m256i lowNibbleMask = _mm256_set1_epi8(0x0f);
+  __m256i coefficientsVector =
+      _mm256_loadu_si256((const __m256i *)coefficients);
+  __m256i lowNibbles = _mm256_and_si256(coefficientsVector, lowNibbleMask);
+  __m256i highNibbles = _mm256_and_si256(
+      _mm256_srli_epi16(coefficientsVector, 4), lowNibbleMask);
+
+  __m256i remainder = _mm256_setzero_si256();
+  for (size_t i = 0; i < numDataCodewords; i++) {
+    unsigned char factor =
+        codewords[i] ^
+        (unsigned char)_mm_cvtsi128_si32(_mm256_castsi256_si128(remainder));
+    const __m128i *products = (const __m128i *)gfNibbleProductTable[factor];
+    __m256i lowNibbleProducts =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(products));
+    __m256i highNibbleProducts =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(products + 1));
+
+    // Shift the whole 32 bytes down by one: alignr only works within 128-bit
+    // lanes, so the upper lane is first moved down to feed the lower one.
+    remainder = _mm256_alignr_epi8(
+        _mm256_permute2x128_si256(remainder, remainder, 0x81), remainder, 1);
+
+    remainder = _mm256_xor_si256(
+        remainder,
+        _mm256_xor_si256(_mm256_shuffle_epi8(lowNibbleProducts, lowNibbles),
+                         _mm256_shuffle_epi8(highNibbleProducts, highNibbles)));
   }
 
-  if (a == 0) {
-    return 0;
+  unsigned char remainderBytes[SIMD_REMAINDER_SIZE];
+  _mm256_storeu_si256((__m256i *)remainderBytes, remainder);
+  memcpy(codewords + numDataCodewords, remainderBytes, degree);
+}
+#endif
+
+typedef void (*DividePolynomialFunction)(unsigned char *codewords,
+                                         size_t numDataCodewords,
+                                         unsigned int degree);
+
+// The split-nibble implementation supported by this CPU, picked at runtime.
+static DividePolynomialFunction dividePolynomialSplitNibble;
+static pthread_once_t dividePolynomialSplitNibbleOnce = PTHREAD_ONCE_INIT;
+
+static void selectDividePolynomialSplitNibble(void) {
+#ifdef HAVE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    dividePolynomialSplitNibble = dividePolynomialAvx2;
+    return;
+  }
+  if (__builtin_cpu_supports("ssse3")) {
+    dividePolynomialSplitNibble = dividePolynomialSsse3;
+    return;
   }
+#endif
+  // Without a byte shuffle instruction, the generator rows are the fastest
+  // scalar implementation.
+  dividePolynomialSplitNibble = dividePolynomialGeneratorRows;
+}
 
-  // Remember: a / b = exp(log(a) - log(b))
-  int logDiff = gfLogLookupTable[a] - gfLogLookupTable[b];
-  if (logDiff < 0) {
-    logDiff += GF_SIZE - 1;
+void setGfMulBackend(GfMulBackend backend) {
+  if (backend == GF_MUL_PRODUCT_TABLE) {
+    pthread_once(&gfProductTableOnce, initGfProductTable);
+  } else if (backend == GF_MUL_SPLIT_NIBBLE) {
+    pthread_once(&dividePolynomialSplitNibbleOnce,
+                 selectDividePolynomialSplitNibble);
   }
-  return gfExpLookupTable[(unsigned char)logDiff];
+  gfMulBackend = backend;
+}
+
+bool writeErrorCorrectionCodewords(unsigned char *codewords,
+                                   size_t numDataCodewords,
+                                   unsigned int numEcCodewords) {
+  if (numEcCodewords == 0 || numDataCodewords == 0 || codewords == NULL ||
+      numEcCodewords > MAX_GENERATOR_POLYNOMIAL_DEGREE) {
+    return false;
+  }
+
+  // Polynomial Division in GF(256).
+  switch (gfMulBackend) {
+    case GF_MUL_LOG_EXP:
+      dividePolynomialLogExp(codewords, numDataCodewords, numEcCodewords);
+      break;
+    case GF_MUL_PRODUCT_TABLE:
+      dividePolynomialProductTable(codewords, numDataCodewords,
+                                   numEcCodewords);
+      break;
+    case GF_MUL_GENERATOR_ROWS:
+      dividePolynomialGeneratorRows(codewords, numDataCodewords,
+                                    numEcCodewords);
+      break;
+    case GF_MUL_SPLIT_NIBBLE:
+      pthread_once(&dividePolynomialSplitNibbleOnce,
+                   selectDividePolynomialSplitNibble);
+      dividePolynomialSplitNibble(codewords, numDataCodewords, numEcCodewords);
+      break;
+  }
+  return true;
 }
-// Galois Field ---------------------------------------------------------------
 
-// Reed-Solomon implementation ------------------------------------------------
 unsigned char *createErrorCorrectionCodewords(
     const unsigned char *dataCodewords, size_t numDataCodewords,
     unsigned int numEcCodewords) {
-  if (numEcCodewords == 0 || numDataCodewords == 0 || dataCodewords == NULL) {
+  if (numEcCodewords == 0 || numDataCodewords == 0 || dataCodewords == NULL ||
+      numEcCodewords > MAX_GENERATOR_POLYNOMIAL_DEGREE) {
     return NULL;
   }
 
-  // See Table A.1
-  unsigned char generatorPolynomialCoefficients[] = {
-      1,                      // Coefficient of x^7 (always 1)
-      gfExpLookupTable[87],   // Coefficient of x^6 (α^87)
-      gfExpLookupTable[229],  // Coefficient of x^5 (α^229)
-      gfExpLookupTable[146],  // Coefficient of x^4 (α^146)
-      gfExpLookupTable[149],  // Coefficient of x^3 (α^149)
-      gfExpLookupTable[238],  // Coefficient of x^2 (α^238)
-      gfExpLookupTable[102],  // Coefficient of x^1 (α^102)
-      gfExpLookupTable[21]    // Coefficient of x^0 (α^21)
-  };
-
   unsigned char *messagePolynomial = (unsigned char *)calloc(
       numDataCodewords + numEcCodewords, sizeof(unsigned char));
   if (messagePolynomial == NULL) {
@@ -146,20 +440,8 @@ unsigned char *createErrorCorrectionCodewords(
   }
   memcpy(messagePolynomial, dataCodewords,
          numDataCodewords * sizeof(unsigned char));
-
-  // Polynomial Division in GF(256).
-  for (unsigned int i = 0; i < numDataCodewords; i++) {
-    unsigned char factor = messagePolynomial[i];
-    if (factor == 0) {
-      continue;
-    }
-
-    for (unsigned int j = 0; j < numEcCodewords + 1; j++) {
-      messagePolynomial[i + j] =
-          gfSub(messagePolynomial[i + j],
-                gfMul(factor, generatorPolynomialCoefficients[j]));
-    }
-  }
+  writeErrorCorrectionCodewords(messagePolynomial, numDataCodewords,
+                                numEcCodewords);
 
   unsigned char *ecCodewords =
       (unsigned char *)calloc(numEcCodewords, sizeof(unsigned char));
@@ -179,296 +461,2157 @@ unsigned char *createErrorCorrectionCodewords(
 }
 // Reed-Solomon implementation ------------------------------------------------
 
-/** Encodes an input string into bytes.
- *
- * These bytes include:
- * - The mode indicator (ENCODING_MODE_INDICATOR_BYTE)
- * - The count of characters in the orignal string (must be in 8bit)
- * - The actual string, encoded using utf8 bytes
- * - Terminator pattern (0000) if there is still space left
- * - Padding (if necessary)
+// Versions -------------------------------------------------------------------
+
+// See Table 9, indexed by error correction level and version. Version 0 is
+// unused.
+static const unsigned char ecCodewordsPerBlock[4][MAX_VERSION + 1] = {
+    {0,  7,  10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26,
+     30, 22, 24, 28, 30, 28, 28, 28, 28, 30, 30, 26, 28, 30,
+     30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    {0,  10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22,
+     24, 24, 28, 28, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28,
+     28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {0,  13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24,
+     20, 30, 24, 28, 28, 26, 30, 28, 30, 30, 30, 30, 28, 30,
+     30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    {0,  17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22,
+     24, 24, 30, 28, 28, 26, 28, 30, 24, 30, 30, 30, 30, 30,
+     30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30}};
+static const unsigned char numErrorCorrectionBlocks[4][MAX_VERSION + 1] = {
+    {0,  1,  1,  1,  1,  1,  2,  2,  2,  2,  4,  4,  4,  4,
+     4,  6,  6,  6,  6,  7,  8,  8,  9,  9,  10, 12, 12, 12,
+     13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25},
+    {0,  1,  1,  1,  2,  2,  4,  4,  4,  5,  5,  5,  8,  9,
+     9,  10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25,
+     26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49},
+    {0,  1,  1,  2,  2,  4,  4,  6,  6,  8,  8,  8,  10, 12,
+     16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34, 34,
+     35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68},
+    {0,  1,  1,  2,  4,  4,  4,  5,  6,  8,  8,  11, 11, 16,
+     16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37, 40,
+     42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81}};
+
+#define VERSION_INFORMATION_GENERATOR 0b1111100100101
+#define MAX_ALIGNMENT_PATTERNS 7
+
+static unsigned int getSideLength(unsigned int version) {
+  return 17 + 4 * version;
+}
+
+/** Number of modules left for codewords once all the function patterns are
+ * placed, see Table 1. Includes the remainder bits.
  */
-unsigned char *encodeString(const unsigned char *str, size_t codewordsSize) {
-  size_t strLength = strlen((const char *)str);
-  // 4 bits for the encoding mode, 8 bits for the string length -> 2 bytes out
-  // of the available codewordsSize are not usable.
-  if (strLength > codewordsSize - 2) {
-    fprintf(stderr, "Input string too long: %zu\n", strLength);
-    return NULL;
+static unsigned int getNumRawDataModules(unsigned int version) {
+  unsigned int sideLength = getSideLength(version);
+  // Finder patterns with their separators and format information, timing
+  // patterns and dark module.
+  unsigned int result = sideLength * sideLength - 3 * 8 * 8 - 2 * 15 -
+                        2 * (sideLength - 16) - 1;
+  if (version >= 2) {
+    // Alignment patterns, minus the modules they share with timing patterns.
+    unsigned int numAlignment = version / 7 + 2;
+    result -= (numAlignment * numAlignment - 3) * 25 -
+              (numAlignment - 2) * 2 * 5;
+  }
+  if (version >= 7) {
+    // Two version information blocks.
+    result -= 2 * 18;
   }
-  unsigned char strLengthByte = (unsigned char)strLength;
+  return result;
+}
 
-  unsigned char *bitStream =
-      (unsigned char *)calloc(codewordsSize, sizeof(unsigned char));
-  bitStream[0] = ENCODING_MODE_INDICATOR_BYTE << 4;
-  bitStream[0] |= strLengthByte >> 4;
-  bitStream[1] = strLengthByte << 4;
+static unsigned int getNumCodewords(unsigned int version) {
+  return getNumRawDataModules(version) / 8;
+}
 
-  // Note that the memory is 0-ed already, so e.g. the terminator pattern does
-  // not need to be applied manually.
-  unsigned int bitStreamIndex = 1;
-  for (unsigned int i = 0; i < strLength && bitStreamIndex < codewordsSize;
-       i++) {
-    unsigned char ch = str[i];
-    bitStream[bitStreamIndex] |= ch >> 4;
-    bitStream[++bitStreamIndex] = ch << 4;
+static unsigned int getNumDataCodewords(unsigned int version,
+                                        ErrorCorrectionLevel level) {
+  return getNumCodewords(version) - ecCodewordsPerBlock[level][version] *
+                                        numErrorCorrectionBlocks[level][version];
+}
+
+/** Number of bits of the character count indicator in the given mode, see
+ * Table 3.
+ */
+static unsigned int getCharacterCountBits(EncodingMode mode,
+                                          unsigned int version) {
+  // For versions 1 to 9, 10 to 26 and 27 to 40.
+  static const unsigned char CHARACTER_COUNT_BITS[NUM_ENCODING_MODES][3] = {
+      {10, 12, 14},  // Numeric.
+      {9, 11, 13},   // Alphanumeric.
+      {8, 16, 16},   // Byte.
+      {8, 10, 12},   // Kanji.
+  };
+  return CHARACTER_COUNT_BITS[mode][version <= 9 ? 0 : version <= 26 ? 1 : 2];
+}
+
+/** Number of bits of a segment of numChars characters in the given mode,
+ * mode indicator and character count included, see 7.4.
+ */
+static size_t getSegmentBits(EncodingMode mode, size_t numChars,
+                             unsigned int version) {
+  size_t numDataBits;
+  if (mode == ENCODING_MODE_NUMERIC) {
+    // 10 bits per group of 3 digits, 4 or 7 bits for the 1 or 2 left.
+    static const unsigned char REMAINDER_BITS[3] = {0, 4, 7};
+    numDataBits = numChars / 3 * 10 + REMAINDER_BITS[numChars % 3];
+  } else if (mode == ENCODING_MODE_ALPHANUMERIC) {
+    // 11 bits per pair of characters, 6 bits for the one left.
+    numDataBits = numChars / 2 * 11 + numChars % 2 * 6;
+  } else if (mode == ENCODING_MODE_KANJI) {
+    numDataBits = 13 * numChars;
+  } else {
+    numDataBits = 8 * numChars;
   }
+  return 4 + getCharacterCountBits(mode, version) + numDataBits;
+}
 
-  // Add padding.
-  bool lastPatternFirst = false;
-  for (++bitStreamIndex; bitStreamIndex < codewordsSize; bitStreamIndex++) {
-    bitStream[bitStreamIndex] = lastPatternFirst ? 0b00010001 : 0b11101100;
-    lastPatternFirst = !lastPatternFirst;
+/** Fills positions with the row (and column) coordinates of the centers of
+ * the alignment patterns, see Annex E, and returns how many there are.
+ */
+static unsigned int getAlignmentPatternPositions(
+    unsigned int version, unsigned int positions[MAX_ALIGNMENT_PATTERNS]) {
+  if (version == 1) {
+    return 0;
   }
 
-  return bitStream;
+  // The first pattern is always on the timing patterns and the last one is 7
+  // modules away from the edge. The others are evenly spaced between them by
+  // an even step, with any leftover going to the gap next to the first.
+  unsigned int numAlignment = version / 7 + 2;
+  unsigned int step =
+      version == 32 ? 26
+                    : (version * 4 + numAlignment * 2 + 1) /
+                          (numAlignment * 2 - 2) * 2;
+  positions[0] = 6;
+  for (unsigned int i = numAlignment - 1, position = getSideLength(version) - 7;
+       i >= 1; i--, position -= step) {
+    positions[i] = position;
+  }
+  return numAlignment;
 }
 
-bool isHorizontalTimingPattern(unsigned int sideLength, int row, int column) {
-  return row == FINDER_PATTERN_SIZE_LENGTH - 1 &&
-         column >= FINDER_PATTERN_SIZE_LENGTH + 1 &&
-         column <= sideLength - FINDER_PATTERN_SIZE_LENGTH - 2;
+// Versions -------------------------------------------------------------------
+
+// Portable popcount: without -mpopcnt, __builtin_popcountll is a library
+// call. See Hacker's Delight, 5-1.
+static inline unsigned int countBits(uint64_t word) {
+  word -= (word >> 1) & UINT64_C(0x5555555555555555);
+  word = (word & UINT64_C(0x3333333333333333)) +
+         ((word >> 2) & UINT64_C(0x3333333333333333));
+  word = (word + (word >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+  return (word * UINT64_C(0x0101010101010101)) >> 56;
 }
 
-bool isVerticalTimingPattern(unsigned int sideLength, int row, int column) {
-  return column == FINDER_PATTERN_SIZE_LENGTH - 1 &&
-         row >= FINDER_PATTERN_SIZE_LENGTH + 1 &&
-         row <= sideLength - FINDER_PATTERN_SIZE_LENGTH - 2;
+// Bytes are read 8 at a time as little endian words, whatever the byte order
+// of the CPU, so that the first one is in the low bits.
+static inline uint64_t loadLittleEndian64(const unsigned char *bytes) {
+  uint64_t word;
+  memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  word = __builtin_bswap64(word);
+#endif
+  return word;
 }
 
-bool isEncodingRegion(unsigned int sideLength, int row, int col) {
-  if (row < 0 || row >= sideLength || col < 0 || col >= sideLength) {
-    return false;
+#define REPEAT_BYTE(b) (0x0101010101010101ULL * (b))
+
+// Returns true if the 8 bytes of word are all ASCII digits: their high
+// nibble is 3 and adding 6 to their low nibble does not carry out of it.
+static inline bool areDigits(uint64_t word) {
+  return (word & REPEAT_BYTE(0xf0)) == REPEAT_BYTE(0x30) &&
+         ((word + REPEAT_BYTE(0x06)) & REPEAT_BYTE(0xf0)) == REPEAT_BYTE(0x30);
+}
+
+static bool isNumeric(const unsigned char *str, size_t strLength) {
+  size_t i = 0;
+  for (; i + 8 <= strLength; i += 8) {
+    if (!areDigits(loadLittleEndian64(str + i))) {
+      return false;
+    }
+  }
+  for (; i < strLength; i++) {
+    if (str[i] < '0' || str[i] > '9') {
+      return false;
+    }
   }
+  return true;
+}
 
-  if (isHorizontalTimingPattern(sideLength, row, col) ||
-      isVerticalTimingPattern(sideLength, row, col)) {
-    return false;
+// UTF-8 validation -----------------------------------------------------------
+
+// Byte mode segments are declared as UTF-8 (see writeSegments), so strings
+// must be valid UTF-8, see RFC 3629: no overlong sequences, surrogates, code
+// points past U+10FFFF or truncated sequences. Every string is checked before
+// it is encoded, in bulk: runs of ASCII are skipped 64 bytes (32 without
+// SIMD) at a time, and other vectors are checked without branching on their
+// bytes.
+
+// Returns true if the string is valid UTF-8, 32 bytes at a time while they
+// are ASCII, one sequence at a time otherwise.
+static bool isValidUtf8Scalar(const unsigned char *str, size_t strLength) {
+  size_t i = 0;
+  while (i < strLength) {
+    if (i + 32 <= strLength &&
+        ((loadLittleEndian64(str + i) | loadLittleEndian64(str + i + 8) |
+          loadLittleEndian64(str + i + 16) |
+          loadLittleEndian64(str + i + 24)) &
+         REPEAT_BYTE(0x80)) == 0) {
+      i += 32;
+      continue;
+    }
+    unsigned char lead = str[i];
+    size_t length;
+    if (lead < 0x80) {
+      i++;
+      continue;
+    } else if (lead >= 0xc2 && lead <= 0xdf) {
+      length = 2;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+      length = 3;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+      length = 4;
+    } else {
+      return false;
+    }
+    if (strLength - i < length) {
+      return false;
+    }
+    for (size_t k = 1; k < length; k++) {
+      if ((str[i + k] & 0xc0) != 0x80) {
+        return false;
+      }
+    }
+    // Overlong sequences of 3 and 4 bytes, surrogates and code points past
+    // U+10FFFF all show in the range of the second byte.
+    unsigned char second = str[i + 1];
+    if ((lead == 0xe0 && second < 0xa0) || (lead == 0xed && second > 0x9f) ||
+        (lead == 0xf0 && second < 0x90) || (lead == 0xf4 && second > 0x8f)) {
+      return false;
+    }
+    i += length;
   }
+  return true;
+}
 
-  // Bottom left finder pattern and format information collision.
-  if (row >= sideLength - FINDER_PATTERN_SIZE_LENGTH - 1 &&
-      col <= FINDER_PATTERN_SIZE_LENGTH + 1) {
-    return false;
+#ifdef HAVE_X86_SIMD
+
+// The vectors are checked as in "Validating UTF-8 In Less Than One
+// Instruction Per Byte" (Keiser and Lemire, 2021). Every error but a missing
+// third or fourth byte is a pair of bytes whose nibbles match one of these
+// patterns: pshufb looks up the patterns matching the high nibble of the
+// first byte, its low nibble and the high nibble of the second byte, and the
+// pair is invalid if the three share one.
+// 11______ 0_______, 11______ 11______
+#define UTF8_TOO_SHORT (1 << 0)
+// 0_______ 10______
+#define UTF8_TOO_LONG (1 << 1)
+// 11100000 100_____
+#define UTF8_OVERLONG_3 (1 << 2)
+// 11110100 1001____, 11110100 101_____, 11110101 10______, 1111011_ 10______,
+// 11111___ 10______
+#define UTF8_TOO_LARGE (1 << 3)
+// 11101101 101_____
+#define UTF8_SURROGATE (1 << 4)
+// 1100000_ 10______
+#define UTF8_OVERLONG_2 (1 << 5)
+// 11110101 1000____, 1111011_ 1000____, 11111___ 1000____
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+// 11110000 1000____, which never shares a first byte with UTF8_TOO_LARGE_1000.
+#define UTF8_OVERLONG_4 (1 << 6)
+// 10______ 10______
+#define UTF8_TWO_CONTINUATIONS (1 << 7)
+// The patterns that do not depend on the low nibble of the first byte.
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTINUATIONS)
+
+static const unsigned char UTF8_FIRST_HIGH_NIBBLE_ERRORS[16] = {
+    // 0_______: ASCII.
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    // 10______: continuation byte.
+    UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS,
+    UTF8_TWO_CONTINUATIONS,
+    // 110_____: lead of 2 bytes.
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT,
+    // 1110____: lead of 3 bytes.
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    // 1111____: lead of 4 bytes or more.
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+static const unsigned char UTF8_FIRST_LOW_NIBBLE_ERRORS[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+static const unsigned char UTF8_SECOND_HIGH_NIBBLE_ERRORS[16] = {
+    // 0_______: ASCII.
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    // 1000____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    // 1001____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    // 101_____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS |
+        UTF8_SURROGATE | UTF8_TOO_LARGE,
+    // 11______: lead byte.
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+};
+
+// Lowest bytes that start a sequence going past the end of a vector, when
+// they are in its last 3 bytes, subtracted from it with saturation.
+static const unsigned char UTF8_INCOMPLETE_LIMITS[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf,
+};
+
+// Returns the errors of the 16 bytes of input, given the 16 bytes before
+// them: non-zero bytes if any.
+__attribute__((target("ssse3"))) static __m128i checkUtf8Ssse3(
+    __m128i input, __m128i previous) {
+  const __m128i lowNibbleMask = _mm_set1_epi8(0x0f);
+  __m128i previous1 = _mm_alignr_epi8(input, previous, 15);
+  __m128i errors = _mm_and_si128(
+      _mm_and_si128(
+          _mm_shuffle_epi8(
+              _mm_loadu_si128((const __m128i *)UTF8_FIRST_HIGH_NIBBLE_ERRORS),
+              _mm_and_si128(_mm_srli_epi16(previous1, 4), lowNibbleMask)),
+          _mm_shuffle_epi8(
+              _mm_loadu_si128((const __m128i *)UTF8_FIRST_LOW_NIBBLE_ERRORS),
+              _mm_and_si128(previous1, lowNibbleMask))),
+      _mm_shuffle_epi8(
+          _mm_loadu_si128((const __m128i *)UTF8_SECOND_HIGH_NIBBLE_ERRORS),
+          _mm_and_si128(_mm_srli_epi16(input, 4), lowNibbleMask)));
+
+  // The third and fourth bytes of a sequence must be continuation bytes,
+  // which the lookups flag as UTF8_TWO_CONTINUATIONS: the flag is expected
+  // there, and an error anywhere else. Only leads of 3 and 4 bytes keep their
+  // high bit after the saturating subtractions.
+  __m128i isThirdByte = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 14),
+                                      _mm_set1_epi8((char)(0xe0 - 0x80)));
+  __m128i isFourthByte = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 13),
+                                       _mm_set1_epi8((char)(0xf0 - 0x80)));
+  __m128i mustBeContinuation =
+      _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte),
+                    _mm_set1_epi8((char)UTF8_TWO_CONTINUATIONS));
+  return _mm_xor_si128(errors, mustBeContinuation);
+}
+
+__attribute__((target("ssse3"))) static bool isValidUtf8Ssse3(
+    const unsigned char *str, size_t strLength) {
+  const __m128i incompleteLimits =
+      _mm_loadu_si128((const __m128i *)(UTF8_INCOMPLETE_LIMITS + 16));
+  __m128i previous = _mm_setzero_si128();
+  __m128i previousIncomplete = _mm_setzero_si128();
+  __m128i errors = _mm_setzero_si128();
+  size_t i = 0;
+  // 64 bytes at a time, skipped at once if they are all ASCII: then only a
+  // sequence left unfinished by the bytes before can be wrong.
+  for (; i + 64 <= strLength; i += 64) {
+    __m128i inputs[4];
+    for (int k = 0; k < 4; k++) {
+      inputs[k] = _mm_loadu_si128((const __m128i *)(str + i + 16 * k));
+    }
+    __m128i highBits = _mm_or_si128(_mm_or_si128(inputs[0], inputs[1]),
+                                    _mm_or_si128(inputs[2], inputs[3]));
+    if (_mm_movemask_epi8(highBits) == 0) {
+      errors = _mm_or_si128(errors, previousIncomplete);
+    } else {
+      for (int k = 0; k < 4; k++) {
+        errors = _mm_or_si128(errors, checkUtf8Ssse3(inputs[k], previous));
+        previous = inputs[k];
+      }
+      previousIncomplete = _mm_subs_epu8(inputs[3], incompleteLimits);
+    }
+    previous = inputs[3];
   }
+  for (; i + 16 <= strLength; i += 16) {
+    __m128i input = _mm_loadu_si128((const __m128i *)(str + i));
+    errors = _mm_or_si128(errors, checkUtf8Ssse3(input, previous));
+    previous = input;
+  }
+  // The last bytes are padded with zeros, which also catch a sequence that
+  // does not end with the string.
+  unsigned char last[16] = {0};
+  memcpy(last, str + i, strLength - i);
+  errors = _mm_or_si128(
+      errors,
+      checkUtf8Ssse3(_mm_loadu_si128((const __m128i *)last), previous));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) ==
+         0xffff;
+}
 
-  // Top right finder pattern and format information collision.
-  if (row <= FINDER_PATTERN_SIZE_LENGTH + 1 &&
-      col >= sideLength - FINDER_PATTERN_SIZE_LENGTH - 1) {
-    return false;
+// Same as checkUtf8Ssse3, on 32 bytes.
+__attribute__((target("avx2"))) static __m256i checkUtf8Avx2(
+    __m256i input, __m256i previous) {
+  const __m256i lowNibbleMask = _mm256_set1_epi8(0x0f);
+  // alignr only works within 128-bit lanes: the lower lane of input is
+  // preceded by the upper lane of previous.
+  __m256i preceding = _mm256_permute2x128_si256(previous, input, 0x21);
+  __m256i previous1 = _mm256_alignr_epi8(input, preceding, 15);
+  __m256i errors = _mm256_and_si256(
+      _mm256_and_si256(
+          _mm256_shuffle_epi8(
+              _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                  (const __m128i *)UTF8_FIRST_HIGH_NIBBLE_ERRORS)),
+              _mm256_and_si256(_mm256_srli_epi16(previous1, 4),
+                               lowNibbleMask)),
+          _mm256_shuffle_epi8(
+              _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                  (const __m128i *)UTF8_FIRST_LOW_NIBBLE_ERRORS)),
+              _mm256_and_si256(previous1, lowNibbleMask))),
+      _mm256_shuffle_epi8(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128(
+              (const __m128i *)UTF8_SECOND_HIGH_NIBBLE_ERRORS)),
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbleMask)));
+
+  __m256i isThirdByte =
+      _mm256_subs_epu8(_mm256_alignr_epi8(input, preceding, 14),
+                       _mm256_set1_epi8((char)(0xe0 - 0x80)));
+  __m256i isFourthByte =
+      _mm256_subs_epu8(_mm256_alignr_epi8(input, preceding, 13),
+                       _mm256_set1_epi8((char)(0xf0 - 0x80)));
+  __m256i mustBeContinuation =
+      _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte),
+                       _mm256_set1_epi8((char)UTF8_TWO_CONTINUATIONS));
+  return _mm256_xor_si256(errors, mustBeContinuation);
+}
+
+__attribute__((target("avx2"))) static bool isValidUtf8Avx2(
+    const unsigned char *str, size_t strLength) {
+  const __m256i incompleteLimits =
+      _mm256_loadu_si256((const __m256i *)UTF8_INCOMPLETE_LIMITS);
+  __m256i previous = _mm256_setzero_si256();
+  __m256i previousIncomplete = _mm256_setzero_si256();
+  __m256i errors = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 64 <= strLength; i += 64) {
+    __m256i first = _mm256_loadu_si256((const __m256i *)(str + i));
+    __m256i second = _mm256_loadu_si256((const __m256i *)(str + i + 32));
+    if (_mm256_movemask_epi8(_mm256_or_si256(first, second)) == 0) {
+      errors = _mm256_or_si256(errors, previousIncomplete);
+    } else {
+      errors = _mm256_or_si256(errors, checkUtf8Avx2(first, previous));
+      errors = _mm256_or_si256(errors, checkUtf8Avx2(second, first));
+      previousIncomplete = _mm256_subs_epu8(second, incompleteLimits);
+    }
+    previous = second;
+  }
+  if (i + 32 <= strLength) {
+    __m256i input = _mm256_loadu_si256((const __m256i *)(str + i));
+    errors = _mm256_or_si256(errors, checkUtf8Avx2(input, previous));
+    previous = input;
+    i += 32;
   }
+  unsigned char last[32] = {0};
+  memcpy(last, str + i, strLength - i);
+  errors = _mm256_or_si256(
+      errors,
+      checkUtf8Avx2(_mm256_loadu_si256((const __m256i *)last), previous));
+  return _mm256_testz_si256(errors, errors);
+}
+#endif
 
-  // Top left finder pattern and format information collision.
-  if (row <= FINDER_PATTERN_SIZE_LENGTH + 1 &&
-      col <= FINDER_PATTERN_SIZE_LENGTH + 1) {
-    return false;
+typedef bool (*ValidateUtf8Function)(const unsigned char *str,
+                                     size_t strLength);
+
+// The implementation supported by this CPU, picked at runtime.
+static ValidateUtf8Function validateUtf8;
+static pthread_once_t validateUtf8Once = PTHREAD_ONCE_INIT;
+
+static void selectValidateUtf8(void) {
+#ifdef HAVE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    validateUtf8 = isValidUtf8Avx2;
+    return;
   }
+  if (__builtin_cpu_supports("ssse3")) {
+    validateUtf8 = isValidUtf8Ssse3;
+    return;
+  }
+#endif
+  validateUtf8 = isValidUtf8Scalar;
+}
 
-  return true;
+static bool isValidUtf8(const unsigned char *str, size_t strLength) {
+  pthread_once(&validateUtf8Once, selectValidateUtf8);
+  return validateUtf8(str, strLength);
 }
 
-void writeEncodedString(unsigned int sideLength,
-                        const unsigned char *encodedStr,
-                        size_t encodedStrLength) {
-  /**
-   * NOTE: this implementation takes some shortcuts under the assumption we are
-   * generating a Version 1 QR Code. See page 10 of the specs for a clear
-   * picture of what we are simplifying here.
-   */
-
-  int direction = -1;
-  int row = sideLength - 1;
-  int column =
-      sideLength - 1;  // Always the rightmost column of the pair of modules.
-  for (unsigned int i = 0; i < encodedStrLength; i++) {
-    unsigned char word = encodedStr[i];
-
-    if (!isEncodingRegion(sideLength, row, column)) {
-      direction *= -1;
-      row += direction;
-      column -= 2;
-
-      if (isVerticalTimingPattern(sideLength, row, column)) {
-        column -= 1;
-      }
+// UTF-8 validation -----------------------------------------------------------
+
+// Returns the 13-bit value in Kanji mode (see 7.4.6) of the character whose
+// UTF-8 sequence starts str, and stores the length of the sequence in
+// *length, or returns -1 if the character is not one of Kanji mode. Those are
+// all in the Basic Multilingual Plane, out of ASCII: only sequences of 2 or 3
+// bytes need to be decoded. Their values come from the rank tables of
+// kanji_tables.h, generated by tools/gen_kanji_tables.py: two reads and a
+// popcount, instead of a search in the 6879 characters of Kanji mode.
+static int getKanjiValue(const unsigned char *str, size_t strLength,
+                         size_t *length) {
+  uint32_t codePoint;
+  size_t sequenceLength;
+  if (strLength >= 2 && str[0] >= 0xc2 && str[0] < 0xe0 &&
+      (str[1] & 0xc0) == 0x80) {
+    codePoint = (uint32_t)(str[0] & 0x1f) << 6 | (str[1] & 0x3f);
+    sequenceLength = 2;
+  } else if (strLength >= 3 && (str[0] & 0xf0) == 0xe0 &&
+             (str[1] & 0xc0) == 0x80 && (str[2] & 0xc0) == 0x80) {
+    codePoint = (uint32_t)(str[0] & 0x0f) << 12 |
+                (uint32_t)(str[1] & 0x3f) << 6 | (str[2] & 0x3f);
+    sequenceLength = 3;
+    // Overlong sequences are not valid UTF-8: they stay bytes.
+    if (codePoint < 0x800) {
+      return -1;
+    }
+  } else {
+    return -1;
+  }
+
+  unsigned int block = kanjiBlockIndex[codePoint >> KANJI_BLOCK_BITS];
+  if (block == 0) {
+    return -1;
+  }
+  const KanjiBlock *kanjiBlock = &kanjiBlocks[block - 1];
+  uint64_t bit = UINT64_C(1)
+                 << (codePoint & ((UINT32_C(1) << KANJI_BLOCK_BITS) - 1));
+  if ((kanjiBlock->mask & bit) == 0) {
+    return -1;
+  }
+  *length = sequenceLength;
+  return kanjiValues[kanjiBlock->firstValue +
+                     countBits(kanjiBlock->mask & (bit - 1))];
+}
+
+// The segmentation counts bits in sixths, so that a character takes a whole
+// number of them in every mode: 10 / 3 bits for a digit, 11 / 2 bits for an
+// alphanumeric character. The cost of a segment is rounded up to whole bits
+// when it ends, which gives its exact length.
+#define SEGMENT_COST_UNITS 6
+// Cost of a character that cannot be encoded in a mode, small enough not to
+// overflow when costs are added to it.
+#define UNENCODABLE_COST (SIZE_MAX / 4)
+
+// Classes of characters: the modes they can be encoded in.
+typedef enum {
+  CHARACTER_CLASS_DIGIT,
+  CHARACTER_CLASS_ALPHANUMERIC,
+  CHARACTER_CLASS_OTHER,
+  // UTF-8 sequences of the characters of Kanji mode.
+  CHARACTER_CLASS_KANJI,
+  // Other UTF-8 sequences of more than one byte.
+  CHARACTER_CLASS_NON_ASCII,
+  NUM_CHARACTER_CLASSES,
+} CharacterClass;
+
+// Cost of a character of each class in each mode, per byte in byte mode.
+static const size_t CHARACTER_COSTS[NUM_CHARACTER_CLASSES]
+                                   [NUM_ENCODING_MODES] = {
+    {20, 33, 48, UNENCODABLE_COST},
+    {UNENCODABLE_COST, 33, 48, UNENCODABLE_COST},
+    {UNENCODABLE_COST, UNENCODABLE_COST, 48, UNENCODABLE_COST},
+    {UNENCODABLE_COST, UNENCODABLE_COST, 48, 78},
+    {UNENCODABLE_COST, UNENCODABLE_COST, 48, UNENCODABLE_COST},
+};
+
+static inline size_t roundUpToBits(size_t cost) {
+  return (cost + SEGMENT_COST_UNITS - 1) / SEGMENT_COST_UNITS *
+         SEGMENT_COST_UNITS;
+}
+
+// Returns the class of the character that starts str, and stores its length
+// in bytes in *length. Digits are the alphanumeric characters of values 0 to
+// 9.
+static inline CharacterClass getCharacterClass(const unsigned char *str,
+                                               size_t strLength,
+                                               size_t *length) {
+  *length = 1;
+  if (str[0] >= 0x80) {
+    if (getKanjiValue(str, strLength, length) >= 0) {
+      return CHARACTER_CLASS_KANJI;
+    }
+    // Valid UTF-8: the length of the sequence is told by its lead byte.
+    *length = 2 + (str[0] >= 0xe0) + (str[0] >= 0xf0);
+    return CHARACTER_CLASS_NON_ASCII;
+  }
+  int value = ALPHANUMERIC_VALUES[str[0]];
+  return (CharacterClass)((value < 0) + ((unsigned int)value >= 10));
+}
 
-      while (!isEncodingRegion(sideLength, row, column)) {
-        // We hit a finder pattern.
-        row += direction;
+// Bits of the ECI header declaring byte mode data as UTF-8, see 7.4.2:
+// the ECI mode indicator and the 8-bit ECI designator.
+#define ECI_HEADER_BITS 12
+#define ECI_MODE_INDICATOR 0b0111
+#define ECI_UTF8_DESIGNATOR 26
+
+// Returns the fewest bits the string takes as segments, see segmentString,
+// the ECI header left out, and sets the bit of every class of its characters
+// in *classes. Characters of Kanji mode may be encoded in byte mode only if
+// kanjiInByteMode is true.
+//
+// Dynamic programming over the characters: costs[m] is the cheapest encoding
+// of the characters so far that ends with a segment in mode m, which either
+// goes on with the next character or is closed before a new segment starts.
+// The mode each cost comes from is kept for every character, 2 bits per
+// mode, in modes (if not NULL), which is then walked back from the end and
+// overwritten with the mode of every character. Linear time, no allocation.
+//
+// Inside a run of characters of the same class, moving the start of a segment
+// towards the mode with the larger characters never takes more bits, so
+// segments only start where the class changes: every run is a single step.
+static size_t findSegments(const unsigned char *str, size_t strLength,
+                           unsigned int version, bool kanjiInByteMode,
+                           unsigned char *modes, unsigned int *classes) {
+  size_t characterCosts[NUM_CHARACTER_CLASSES][NUM_ENCODING_MODES];
+  memcpy(characterCosts, CHARACTER_COSTS, sizeof(characterCosts));
+  if (!kanjiInByteMode) {
+    characterCosts[CHARACTER_CLASS_KANJI][ENCODING_MODE_BYTE] =
+        UNENCODABLE_COST;
+  }
+
+  // Before the first character, a segment of any mode can start at the cost
+  // of its header alone.
+  size_t headerCosts[NUM_ENCODING_MODES];
+  size_t costs[NUM_ENCODING_MODES];
+  unsigned char continuedModes = 0;
+  for (int m = 0; m < NUM_ENCODING_MODES; m++) {
+    headerCosts[m] = SEGMENT_COST_UNITS *
+                     (4 + getCharacterCountBits((EncodingMode)m, version));
+    costs[m] = headerCosts[m];
+    continuedModes |= m << (2 * m);
+  }
+  for (size_t i = 0; i < strLength;) {
+    size_t length;
+    CharacterClass class = getCharacterClass(str + i, strLength - i, &length);
+    size_t runEnd = i + length;
+    size_t runLength = 1;
+    *classes |= 1u << class;
+    while (runEnd < strLength &&
+           getCharacterClass(str + runEnd, strLength - runEnd, &length) ==
+               class) {
+      runEnd += length;
+      runLength++;
+    }
+
+    // The cheapest way to close the segment before the run.
+    int closedMode = 0;
+    for (int m = 1; m < NUM_ENCODING_MODES; m++) {
+      closedMode = costs[m] < costs[closedMode] ? m : closedMode;
+    }
+    size_t closedCost = roundUpToBits(costs[closedMode]);
+
+    unsigned char previousModes = 0;
+    for (int m = 0; m < NUM_ENCODING_MODES; m++) {
+      size_t cost = closedCost + headerCosts[m];
+      int previousMode = closedMode;
+      if (costs[m] < cost) {
+        cost = costs[m];
+        previousMode = m;
       }
+      size_t characterCost = characterCosts[class][m];
+      size_t runSize = m == ENCODING_MODE_BYTE ? runEnd - i : runLength;
+      costs[m] = characterCost == UNENCODABLE_COST
+                     ? UNENCODABLE_COST
+                     : cost + runSize * characterCost;
+      previousModes |= previousMode << (2 * m);
+    }
+    if (modes != NULL) {
+      modes[i] = previousModes;
+      memset(modes + i + 1, continuedModes, runEnd - i - 1);
     }
+    i = runEnd;
+  }
 
-    for (unsigned int j = 0; j < 4; j++) {
-      qrcode[row][column] = (word & (0b10000000 >> (2 * j))) != 0;
-      qrcode[row][column - 1] = (word & (0b10000000 >> (2 * j + 1))) != 0;
-      row += direction;
+  int mode = 0;
+  for (int m = 1; m < NUM_ENCODING_MODES; m++) {
+    if (costs[m] < costs[mode]) {
+      mode = m;
+    }
+  }
+  size_t numBits = roundUpToBits(costs[mode]) / SEGMENT_COST_UNITS;
+  if (modes != NULL) {
+    for (size_t i = strLength; i-- > 0;) {
+      int previousMode = (modes[i] >> (2 * mode)) & 3;
+      modes[i] = (unsigned char)mode;
+      mode = previousMode;
+    }
+  }
+  return numBits;
+}
+
+/** Splits the string, which must be valid UTF-8, into segments of different
+ * modes so that it takes as few bits as possible in a symbol of the given
+ * version, and returns that number of bits, mode indicators, character count
+ * indicators and ECI header included. The mode of every character is written
+ * to modes if not NULL.
+ *
+ * Bytes outside ASCII in byte mode are only read as UTF-8 after an ECI
+ * header, which is written when any of them is (see writeSegments) and
+ * counted here. Characters of Kanji mode are only put in byte mode if that
+ * saves more than the header.
+ */
+static size_t segmentString(const unsigned char *str, size_t strLength,
+                            unsigned int version, unsigned char *modes) {
+  // An empty string is still a byte segment, of no characters.
+  if (strLength == 0) {
+    return getSegmentBits(ENCODING_MODE_BYTE, 0, version);
+  }
+  // Strings of digits are common, and checked much faster than segmented.
+  if (isNumeric(str, strLength)) {
+    if (modes != NULL) {
+      memset(modes, ENCODING_MODE_NUMERIC, strLength);
+    }
+    return getSegmentBits(ENCODING_MODE_NUMERIC, strLength, version);
+  }
 
-      if (isHorizontalTimingPattern(sideLength, row, column)) {
-        row += direction;
+  unsigned int classes = 0;
+  size_t numBits = findSegments(str, strLength, version, true, modes, &classes);
+  if (classes & (1u << CHARACTER_CLASS_NON_ASCII)) {
+    return numBits + ECI_HEADER_BITS;
+  }
+  if (!(classes & (1u << CHARACTER_CLASS_KANJI))) {
+    return numBits;
+  }
+  // Only characters of Kanji mode are outside ASCII: keeping them out of
+  // byte mode saves the ECI header, unless byte mode saves even more.
+  size_t numKanjiModeBits =
+      findSegments(str, strLength, version, false, NULL, &classes);
+  if (numBits + ECI_HEADER_BITS < numKanjiModeBits) {
+    return numBits + ECI_HEADER_BITS;
+  }
+  if (modes != NULL) {
+    findSegments(str, strLength, version, false, modes, &classes);
+  }
+  return numKanjiModeBits;
+}
+
+/** Returns the smallest version the string fits in at the given error
+ * correction level, or 0 if it is too long. The modes of the characters in
+ * that version are written to modes, see segmentString.
+ */
+static unsigned int selectVersion(const unsigned char *str, size_t strLength,
+                                  ErrorCorrectionLevel level,
+                                  unsigned char *modes) {
+  if (strLength > MAX_STRING_LENGTH) {
+    return 0;
+  }
+  // The character count indicators, hence the best segmentation, only change
+  // at versions 10 and 27.
+  static const unsigned int LAST_VERSIONS[] = {9, 26, MAX_VERSION};
+  unsigned int version = MIN_VERSION;
+  for (int i = 0; i < 3; i++) {
+    // No character takes less than the 10 / 3 bits of a digit: the ranges
+    // that are too small anyway are not segmented.
+    if ((strLength * 10 + 2) / 3 >
+        8 * getNumDataCodewords(LAST_VERSIONS[i], level)) {
+      version = LAST_VERSIONS[i] + 1;
+      continue;
+    }
+    size_t numBits = segmentString(str, strLength, LAST_VERSIONS[i], modes);
+    for (; version <= LAST_VERSIONS[i]; version++) {
+      if (numBits <= 8 * getNumDataCodewords(version, level)) {
+        return version;
       }
     }
   }
+  return 0;
+}
+
+// Appends the numBits (at most 25) low bits of value to the bit stream, which
+// must be zeroed past bitLength, most significant bit first.
+static void appendBits(unsigned char *bitStream, size_t *bitLength,
+                       uint32_t value, unsigned int numBits) {
+  unsigned char *out = bitStream + *bitLength / 8;
+  unsigned int end = *bitLength % 8 + numBits;
+  // The first bit of value lands on the next free bit of out[0].
+  uint32_t aligned = value << (32 - end);
+  for (unsigned int i = 0; i < (end + 7) / 8; i++) {
+    out[i] |= aligned >> (24 - 8 * i);
+  }
+  *bitLength += numBits;
+}
+
+// Gathers bits in a word, most significant first, and writes them out a
+// byte at a time.
+typedef struct {
+  unsigned char *out;
+  // Only the low numPending bits are meaningful.
+  uint64_t pending;
+  unsigned int numPending;
+} BitAppender;
+
+static BitAppender startAppending(unsigned char *bitStream, size_t bitLength) {
+  BitAppender appender = {bitStream + bitLength / 8, 0, bitLength % 8};
+  // Take over the bits already in the last, partial byte.
+  appender.pending = *appender.out >> (8 - appender.numPending);
+  return appender;
+}
+
+// Appends the numBits (at most 56) low bits of value.
+static inline void appendPendingBits(BitAppender *appender, uint64_t value,
+                                     unsigned int numBits) {
+  appender->pending = appender->pending << numBits | value;
+  appender->numPending += numBits;
+  while (appender->numPending >= 8) {
+    appender->numPending -= 8;
+    *appender->out++ = (unsigned char)(appender->pending >>
+                                       appender->numPending);
+  }
+}
+
+static void finishAppending(BitAppender *appender) {
+  if (appender->numPending > 0) {
+    *appender->out =
+        (unsigned char)(appender->pending << (8 - appender->numPending));
+  }
+}
+
+// Appends digits in numeric mode: every group of 3 digits is a 10-bit number,
+// the 1 or 2 digits left take 4 or 7 bits.
+static void appendNumericData(unsigned char *bitStream, size_t *bitLength,
+                              const unsigned char *digits, size_t numDigits) {
+  BitAppender appender = startAppending(bitStream, *bitLength);
+  size_t i = 0;
+  // Two groups at a time, converted in the lanes of a word: the bytes of the
+  // 6 digits are d0 to d5, and the groups 100 * d0 + 10 * d1 + d2 and
+  // 100 * d3 + 10 * d4 + d5. Only the first 6 of the 8 bytes read are used.
+  for (; i + 8 <= numDigits; i += 6) {
+    uint64_t values = loadLittleEndian64(digits + i) - REPEAT_BYTE('0');
+    // Byte k becomes 10 * dk + dk+1, at most 99: no carry between bytes.
+    uint64_t pairs = values * 10 + (values >> 8);
+    // 10 * d0 + d1 and 10 * d3 + d4 in 32-bit lanes, then the groups.
+    uint64_t tens = (pairs & 0xff) | (pairs & 0xff000000) << 8;
+    uint64_t units = ((values >> 16) & 0xff) | ((values >> 40) & 0xff) << 32;
+    uint64_t groups = tens * 10 + units;
+    appendPendingBits(&appender, (groups & 0x3ff) << 10 | groups >> 32, 20);
+  }
+  for (; i + 3 <= numDigits; i += 3) {
+    appendPendingBits(&appender,
+                      (digits[i] - '0') * 100 + (digits[i + 1] - '0') * 10 +
+                          (digits[i + 2] - '0'),
+                      10);
+  }
+  if (numDigits - i == 2) {
+    appendPendingBits(&appender,
+                      (digits[i] - '0') * 10 + (digits[i + 1] - '0'), 7);
+  } else if (numDigits - i == 1) {
+    appendPendingBits(&appender, digits[i] - '0', 4);
+  }
+  finishAppending(&appender);
+  *bitLength = 8 * (appender.out - bitStream) + appender.numPending;
+}
+
+// Appends alphanumeric characters: every pair is the 11-bit number
+// 45 * first + second, the one left takes 6 bits.
+static void appendAlphanumericData(unsigned char *bitStream, size_t *bitLength,
+                                   const unsigned char *chars,
+                                   size_t numChars) {
+  BitAppender appender = startAppending(bitStream, *bitLength);
+  size_t i = 0;
+  // Two pairs at a time.
+  for (; i + 4 <= numChars; i += 4) {
+    uint64_t first = ALPHANUMERIC_VALUES[chars[i]] * 45 +
+                     ALPHANUMERIC_VALUES[chars[i + 1]];
+    uint64_t second = ALPHANUMERIC_VALUES[chars[i + 2]] * 45 +
+                      ALPHANUMERIC_VALUES[chars[i + 3]];
+    appendPendingBits(&appender, first << 11 | second, 22);
+  }
+  for (; i + 2 <= numChars; i += 2) {
+    appendPendingBits(&appender,
+                      ALPHANUMERIC_VALUES[chars[i]] * 45 +
+                          ALPHANUMERIC_VALUES[chars[i + 1]],
+                      11);
+  }
+  if (i < numChars) {
+    appendPendingBits(&appender, ALPHANUMERIC_VALUES[chars[i]], 6);
+  }
+  finishAppending(&appender);
+  *bitLength = 8 * (appender.out - bitStream) + appender.numPending;
+}
+
+// Appends characters in Kanji mode, 13 bits each, given their UTF-8
+// sequences.
+static void appendKanjiData(unsigned char *bitStream, size_t *bitLength,
+                            const unsigned char *chars, size_t numBytes) {
+  BitAppender appender = startAppending(bitStream, *bitLength);
+  size_t length;
+  for (size_t i = 0; i < numBytes; i += length) {
+    int value = getKanjiValue(chars + i, numBytes - i, &length);
+    appendPendingBits(&appender, value, 13);
+  }
+  finishAppending(&appender);
+  *bitLength = 8 * (appender.out - bitStream) + appender.numPending;
+}
+
+// Appends bytes in byte mode. Segments before them can end on any bit, so
+// the bytes go through the appender, 4 at a time.
+static void appendByteData(unsigned char *bitStream, size_t *bitLength,
+                           const unsigned char *bytes, size_t numBytes) {
+  BitAppender appender = startAppending(bitStream, *bitLength);
+  size_t i = 0;
+  for (; i + 4 <= numBytes; i += 4) {
+    appendPendingBits(&appender,
+                      (uint32_t)bytes[i] << 24 | bytes[i + 1] << 16 |
+                          bytes[i + 2] << 8 | bytes[i + 3],
+                      32);
+  }
+  for (; i < numBytes; i++) {
+    appendPendingBits(&appender, bytes[i], 8);
+  }
+  finishAppending(&appender);
+  *bitLength = 8 * (appender.out - bitStream) + appender.numPending;
+}
+
+// Appends a segment of the numBytes bytes of chars: its mode indicator,
+// character count indicator and data.
+static void appendSegment(unsigned char *bitStream, size_t *bitLength,
+                          EncodingMode mode, const unsigned char *chars,
+                          size_t numBytes, unsigned int version) {
+  size_t numChars = numBytes;
+  if (mode == ENCODING_MODE_KANJI) {
+    // Count the first bytes of the UTF-8 sequences.
+    for (size_t i = 0; i < numBytes; i++) {
+      numChars -= (chars[i] & 0xc0) == 0x80;
+    }
+  }
+  appendBits(bitStream, bitLength, ENCODING_MODE_INDICATORS[mode], 4);
+  appendBits(bitStream, bitLength, numChars,
+             getCharacterCountBits(mode, version));
+  if (mode == ENCODING_MODE_NUMERIC) {
+    appendNumericData(bitStream, bitLength, chars, numChars);
+  } else if (mode == ENCODING_MODE_ALPHANUMERIC) {
+    appendAlphanumericData(bitStream, bitLength, chars, numChars);
+  } else if (mode == ENCODING_MODE_KANJI) {
+    appendKanjiData(bitStream, bitLength, chars, numBytes);
+  } else {
+    appendByteData(bitStream, bitLength, chars, numChars);
+  }
+}
+
+// Writes the segments of the string, given the modes of its characters, then
+// the terminator and the padding. If any byte outside ASCII is in byte mode,
+// the segments are preceded by the ECI header declaring them UTF-8.
+static void writeSegments(const unsigned char *str, size_t strLength,
+                          const unsigned char *modes, unsigned int version,
+                          unsigned char *bitStream, size_t codewordsSize) {
+  memset(bitStream, 0, codewordsSize);
+  size_t bitLength = 0;
+  for (size_t i = 0; i < strLength; i++) {
+    if (str[i] >= 0x80 && modes[i] == ENCODING_MODE_BYTE) {
+      appendBits(bitStream, &bitLength, ECI_MODE_INDICATOR, 4);
+      appendBits(bitStream, &bitLength, ECI_UTF8_DESIGNATOR, 8);
+      break;
+    }
+  }
+  if (strLength == 0) {
+    appendSegment(bitStream, &bitLength, ENCODING_MODE_BYTE, str, 0, version);
+  }
+  for (size_t start = 0; start < strLength;) {
+    EncodingMode mode = (EncodingMode)modes[start];
+    size_t end = start + 1;
+    while (end < strLength && modes[end] == mode) {
+      end++;
+    }
+    appendSegment(bitStream, &bitLength, mode, str + start, end - start,
+                  version);
+    start = end;
+  }
+
+  // Note that the memory is 0-ed already, so e.g. the terminator pattern does
+  // not need to be applied manually, nor the bits completing the last
+  // codeword after it.
+
+  // Add padding.
+  bool lastPatternFirst = false;
+  for (size_t i = (bitLength + 4 + 7) / 8; i < codewordsSize; i++) {
+    bitStream[i] = lastPatternFirst ? 0b00010001 : 0b11101100;
+    lastPatternFirst = !lastPatternFirst;
+  }
+}
+
+/** Encodes an input string into bytes.
+ *
+ * The string is split into the segments that take the fewest bits, see
+ * segmentString, after an ECI header if byte mode holds UTF-8 sequences of
+ * more than one byte. Each one includes:
+ * - The mode indicator: numeric mode for digits, alphanumeric mode for
+ *   digits, uppercase letters, space and $%*+-./:, byte mode for anything
+ * - The count of characters in the segment (8 to 16 bits, depending on the
+ *   mode and the version)
+ * - The actual characters: groups of 3 digits in 10 bits in numeric mode,
+ *   pairs of characters in 11 bits in alphanumeric mode, the bytes of the
+ *   string as they are in byte mode
+ * They are followed by:
+ * - Terminator pattern (0000) if there is still space left
+ * - Padding (if necessary)
+ */
+bool encodeStringInto(const unsigned char *str, size_t strLength,
+                      unsigned int version, unsigned char *bitStream,
+                      size_t codewordsSize) {
+  if (!isValidUtf8(str, strLength)) {
+    fprintf(stderr, "Input string is not valid UTF-8\n");
+    return false;
+  }
+  unsigned char modes[MAX_STRING_LENGTH];
+  if (strLength > MAX_STRING_LENGTH ||
+      segmentString(str, strLength, version, modes) > 8 * codewordsSize) {
+    fprintf(stderr, "Input string too long: %zu\n", strLength);
+    return false;
+  }
+  writeSegments(str, strLength, modes, version, bitStream, codewordsSize);
+  return true;
+}
+
+unsigned char *encodeString(const unsigned char *str, size_t strLength,
+                            unsigned int version, size_t codewordsSize) {
+  unsigned char *bitStream =
+      (unsigned char *)malloc(codewordsSize * sizeof(unsigned char));
+  if (bitStream == NULL) {
+    return NULL;
+  }
+  if (!encodeStringInto(str, strLength, version, bitStream, codewordsSize)) {
+    free(bitStream);
+    return NULL;
+  }
+  return bitStream;
+}
+
+void writeErrorCorrectionBlocks(QrCode *qrcode) {
+  unsigned int version = qrcode->version;
+  ErrorCorrectionLevel level = qrcode->errorCorrectionLevel;
+  unsigned int numBlocks = numErrorCorrectionBlocks[level][version];
+  unsigned int numEcCodewords = ecCodewordsPerBlock[level][version];
+  unsigned int numDataCodewords = getNumDataCodewords(version, level);
+
+  // See 7.6: the first numShortBlocks blocks have shortBlockDataLength data
+  // codewords, the others one more. All of them have the same number of error
+  // correction codewords.
+  unsigned int shortBlockDataLength = numDataCodewords / numBlocks;
+  unsigned int numShortBlocks =
+      numBlocks - numDataCodewords % numBlocks;
+
+  // Blocks are independent: each one is copied to a buffer of its own, gets
+  // its error correction codewords appended in place and is then scattered to
+  // its interleaved positions, one every numBlocks codewords.
+  const unsigned char *blockData = qrcode->dataCodewords;
+  for (unsigned int i = 0; i < numBlocks; i++) {
+    unsigned int blockDataLength =
+        shortBlockDataLength + (i < numShortBlocks ? 0 : 1);
+    unsigned char block[MAX_BLOCK_CODEWORDS];
+    memcpy(block, blockData, blockDataLength);
+    writeErrorCorrectionCodewords(block, blockDataLength, numEcCodewords);
+    blockData += blockDataLength;
+
+    for (unsigned int j = 0; j < shortBlockDataLength; j++) {
+      qrcode->codewords[j * numBlocks + i] = block[j];
+    }
+    // The extra data codeword of the long blocks comes after all the others.
+    if (i >= numShortBlocks) {
+      qrcode->codewords[shortBlockDataLength * numBlocks + i -
+                        numShortBlocks] = block[shortBlockDataLength];
+    }
+    for (unsigned int j = 0; j < numEcCodewords; j++) {
+      qrcode->codewords[numDataCodewords + j * numBlocks + i] =
+          block[blockDataLength + j];
+    }
+  }
+}
+
+static inline uint64_t getColumnBit(unsigned int column) {
+  return UINT64_C(1) << (column % 64);
+}
+
+static inline bool isFunctionModule(const QrCode *qrcode, unsigned int row,
+                                    unsigned int column) {
+  return (qrcode->functionModules[row][column / 64] &
+          getColumnBit(column)) != 0;
+}
+
+static void setFunctionModule(QrCode *qrcode, unsigned int row,
+                              unsigned int column, bool isBlack) {
+  uint64_t bit = getColumnBit(column);
+  if (isBlack) {
+    qrcode->modules[row][column / 64] |= bit;
+  } else {
+    qrcode->modules[row][column / 64] &= ~bit;
+  }
+  qrcode->functionModules[row][column / 64] |= bit;
+}
+
+/** Returns the 5 bits of error correction level and mask pattern followed by
+ * 10 bits of BCH(15, 5) error correction, masked, see 7.9.1.
+ */
+static unsigned int getFormatInformation(ErrorCorrectionLevel level,
+                                         unsigned int maskPattern) {
+  // Indicators of L, M, Q and H, see Table 12.
+  static const unsigned char errorCorrectionLevelBits[4] = {0b01, 0b00, 0b11,
+                                                            0b10};
+  unsigned int data = errorCorrectionLevelBits[level] << 3 | maskPattern;
+  unsigned int remainder = data;
+  for (int i = 0; i < 10; i++) {
+    remainder = (remainder << 1) ^
+                ((remainder >> 9) * FORMAT_INFORMATION_GENERATOR);
+  }
+  return (data << 10 | remainder) ^ FORMAT_INFORMATION_MASK;
 }
 
-void writeFormatInformation(unsigned int sideLength) {
+void writeFormatInformation(QrCode *qrcode) {
+  unsigned int sideLength = qrcode->sideLength;
+  unsigned int formatInformation =
+      getFormatInformation(qrcode->errorCorrectionLevel, qrcode->maskPattern);
+
   // Placement 1.
   int bitIndex = 0;
   for (unsigned int i = 0; i <= 5; i++) {
-    qrcode[i][FINDER_PATTERN_SIZE_LENGTH + 1] =
-        (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+    setFunctionModule(qrcode, i, FINDER_PATTERN_SIZE_LENGTH + 1,
+                      (formatInformation & (1 << bitIndex++)) != 0);
   }
 
   // Row at index 6 is skipped as there we have the horizontal timing pattern.
-  qrcode[7][FINDER_PATTERN_SIZE_LENGTH + 1] =
-      (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
-  qrcode[8][FINDER_PATTERN_SIZE_LENGTH + 1] =
-      (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+  setFunctionModule(qrcode, 7, FINDER_PATTERN_SIZE_LENGTH + 1,
+                    (formatInformation & (1 << bitIndex++)) != 0);
+  setFunctionModule(qrcode, 8, FINDER_PATTERN_SIZE_LENGTH + 1,
+                    (formatInformation & (1 << bitIndex++)) != 0);
 
-  qrcode[8][FINDER_PATTERN_SIZE_LENGTH] =
-      (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+  setFunctionModule(qrcode, 8, FINDER_PATTERN_SIZE_LENGTH,
+                    (formatInformation & (1 << bitIndex++)) != 0);
   // Column at index 6 is skipped as there we have the vertical timing pattern.
   for (int j = 5; j >= 0; j--) {
-    qrcode[8][j] = (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+    setFunctionModule(qrcode, 8, j,
+                      (formatInformation & (1 << bitIndex++)) != 0);
   }
 
   // Placement 2.
   bitIndex = 0;
   for (unsigned int j = 0; j <= 7; j++) {
-    qrcode[8][sideLength - 1 - j] =
-        (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+    setFunctionModule(qrcode, 8, sideLength - 1 - j,
+                      (formatInformation & (1 << bitIndex++)) != 0);
   }
 
   for (unsigned int i = sideLength - FINDER_PATTERN_SIZE_LENGTH; i < sideLength;
        i++) {
-    qrcode[i][FINDER_PATTERN_SIZE_LENGTH + 1] =
-        (MASKED_FORMAT_INFORMATION & (1 << bitIndex++)) != 0;
+    setFunctionModule(qrcode, i, FINDER_PATTERN_SIZE_LENGTH + 1,
+                      (formatInformation & (1 << bitIndex++)) != 0);
   }
 }
 
-void writeDarkModule(short version) { qrcode[4 * version + 9][8] = 1; }
+void writeVersionInformation(QrCode *qrcode) {
+  if (qrcode->version < 7) {
+    return;
+  }
 
-void render(unsigned int sideLength, unsigned int quiteZoneSize) {
-  int withQuiteZoneSize = sideLength + 2 * quiteZoneSize;
-  for (unsigned int i = 0; i < withQuiteZoneSize; i++) {
-    for (unsigned int j = 0; j < withQuiteZoneSize; j++) {
-      if (i < quiteZoneSize || i >= withQuiteZoneSize - quiteZoneSize ||
-          j < quiteZoneSize || j >= withQuiteZoneSize - quiteZoneSize) {
-        printf("%s", MODULE_WHITE);
-      } else {
-        printf("%s", qrcode[i - quiteZoneSize][j - quiteZoneSize]
-                         ? MODULE_BLACK
-                         : MODULE_WHITE);
-      }
+  // 6 bits of version followed by 12 bits of BCH(18, 6) error correction,
+  // see Annex D.
+  unsigned int remainder = qrcode->version;
+  for (int i = 0; i < 12; i++) {
+    remainder = (remainder << 1) ^
+                ((remainder >> 11) * VERSION_INFORMATION_GENERATOR);
+  }
+  unsigned int versionInformation = qrcode->version << 12 | remainder;
+
+  // A 6x3 block above the bottom left finder pattern and its transposition
+  // on the left of the top right one.
+  unsigned int sideLength = qrcode->sideLength;
+  for (unsigned int bitIndex = 0; bitIndex < 18; bitIndex++) {
+    bool isBlack = (versionInformation & (1 << bitIndex)) != 0;
+    unsigned int a = sideLength - 11 + bitIndex % 3;
+    unsigned int b = bitIndex / 3;
+    setFunctionModule(qrcode, a, b, isBlack);
+    setFunctionModule(qrcode, b, a, isBlack);
+  }
+}
+
+void writeDarkModule(QrCode *qrcode) {
+  setFunctionModule(qrcode, 4 * qrcode->version + 9, 8, true);
+}
+
+// Masking --------------------------------------------------------------------
+
+// Penalty points of the rules of 7.8.3.1, see Table 11.
+#define PENALTY_N1 3
+#define PENALTY_N2 3
+#define PENALTY_N3 40
+#define PENALTY_N4 10
+
+// The penalty rules run on rows and columns padded with 4 light modules on
+// each side, which still fit in MODULE_ROW_WORDS words.
+_Static_assert(MAX_SIDE_LENGTH + 8 <= 64 * MODULE_ROW_WORDS,
+               "Padded lines must fit in a row of modules");
+
+static bool isMasked(unsigned int maskPattern, unsigned int row,
+                     unsigned int col) {
+  // See Table 10.
+  switch (maskPattern) {
+    case 0:
+      return (row + col) % 2 == 0;
+    case 1:
+      return row % 2 == 0;
+    case 2:
+      return col % 3 == 0;
+    case 3:
+      return (row + col) % 3 == 0;
+    case 4:
+      return (row / 2 + col / 3) % 2 == 0;
+    case 5:
+      return row * col % 2 + row * col % 3 == 0;
+    case 6:
+      return (row * col % 2 + row * col % 3) % 2 == 0;
+    default:
+      return ((row + col) % 2 + row * col % 3) % 2 == 0;
+  }
+}
+
+// Returns the bits of word w of a line whose index in the line is below end.
+static inline uint64_t getLineMask(unsigned int w, unsigned int end) {
+  if (end <= 64 * w) {
+    return 0;
+  }
+  return end >= 64 * (w + 1) ? UINT64_MAX : (UINT64_C(1) << (end % 64)) - 1;
+}
+
+// Returns word w of the given row of the mask pattern. Every mask pattern
+// repeats itself every 6 columns, so only the first 6 columns of the word are
+// evaluated and then replicated to the other 58.
+static uint64_t getMaskWord(unsigned int maskPattern, unsigned int row,
+                            unsigned int w) {
+  uint64_t word = 0;
+  for (unsigned int col = 0; col < 6; col++) {
+    if (isMasked(maskPattern, row, 64 * w + col)) {
+      word |= UINT64_C(1) << col;
     }
-    printf("\n");
   }
+  word |= word << 6;
+  word |= word << 12;
+  word |= word << 24;
+  return word | word << 48;
 }
 
-void applyMaskPattern(unsigned int sideLength) {
-  for (unsigned int row = 0; row < sideLength; row++) {
-    for (unsigned int col = 0; col < sideLength; col++) {
-      if (!isEncodingRegion(sideLength, row, col)) {
-        continue;
-      }
+// The penalty is computed on bit-packed lines, bit j of word w being module
+// 64 * w + j of the row or column, so that each rule is evaluated on 64
+// modules at a time with a few shifts, ANDs and popcounts. Modules past the
+// end of the line are 0, i.e. light.
+
+// Returns the word w of line shifted right by shift < 64 bits: bit j of the
+// result is bit j + shift of the line.
+static inline uint64_t getShiftedWord(const uint64_t line[MODULE_ROW_WORDS],
+                                      unsigned int w, unsigned int shift) {
+  if (shift == 0) {
+    return line[w];
+  }
+  uint64_t word = line[w] >> shift;
+  if (w + 1 < MODULE_ROW_WORDS) {
+    word |= line[w + 1] << (64 - shift);
+  }
+  return word;
+}
+
+// Penalty of rules 1 (runs of modules of the same color) and 3 (finder-like
+// patterns) on a single row or column.
+// Only the first numWords words, enough for the line and its padding, are
+// evaluated.
+static inline unsigned int getLinePenalty(
+    const uint64_t line[MODULE_ROW_WORDS], unsigned int sideLength,
+    unsigned int numWords) {
+  // The line with 4 light modules before it, standing for the quiet zone, so
+  // that bit j + 4 of padded is module j.
+  uint64_t padded[MODULE_ROW_WORDS];
+  for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+    padded[w] = line[w] << 4 | (w > 0 ? line[w - 1] >> 60 : 0);
+  }
 
-      if ((row + col) % 2 == 0) {
-        qrcode[row][col] = !qrcode[row][col];
+  unsigned int penalty = 0;
+  uint64_t previousRuns = 0;
+  for (unsigned int w = 0; w < numWords; w++) {
+    // shifted[k] holds the (padded) modules k positions further along.
+    uint64_t shifted[11];
+    for (unsigned int k = 0; k < 11; k++) {
+      shifted[k] = getShiftedWord(padded, w, k);
+    }
+
+    // Rule 1: a run of n >= 5 modules scores N1 + n - 5. Bit j of runs is set
+    // when modules j to j + 4 have the same color, which happens n - 4 times
+    // in the run, and runStarts marks the first of them, which adds the
+    // remaining N1 - 1 points.
+    uint64_t runs = getLineMask(w, sideLength - 4);
+    for (unsigned int k = 5; k < 9; k++) {
+      runs &= ~(shifted[4] ^ shifted[k]);
+    }
+    uint64_t runStarts = runs & ~(runs << 1 | previousRuns >> 63);
+    previousRuns = runs;
+    penalty += countBits(runs) +
+               (PENALTY_N1 - 1) * countBits(runStarts);
+
+    // Rule 3: 1:1:3:1:1 finder-like patterns preceded or followed by 4 light
+    // modules, which may be part of the quiet zone. Bit j is a window
+    // starting at padded module j.
+    uint64_t windows = getLineMask(w, sideLength - 2);
+    uint64_t lightBefore =
+        ~(shifted[0] | shifted[1] | shifted[2] | shifted[3]) & shifted[4] &
+        ~shifted[5] & shifted[6] & shifted[7] & shifted[8] & ~shifted[9] &
+        shifted[10];
+    uint64_t lightAfter =
+        shifted[0] & ~shifted[1] & shifted[2] & shifted[3] & shifted[4] &
+        ~shifted[5] & shifted[6] &
+        ~(shifted[7] | shifted[8] | shifted[9] | shifted[10]);
+    penalty += PENALTY_N3 * countBits(lightBefore & windows) +
+               PENALTY_N3 * countBits(lightAfter & windows);
+  }
+  return penalty;
+}
+
+// Transposes a 64x64 bit matrix in place, swapping bit j of block[i] with bit
+// i of block[j]: the off-diagonal halves are swapped, then recursively the
+// quarters of each half and so on. See Hacker's Delight, 7-3.
+static void transposeBlock(uint64_t block[64]) {
+  uint64_t mask = UINT64_C(0x00000000FFFFFFFF);
+  for (unsigned int width = 32; width != 0;
+       width >>= 1, mask ^= mask << width) {
+    for (unsigned int k = 0; k < 64; k = ((k | width) + 1) & ~width) {
+      uint64_t swapped = (block[k] >> width ^ block[k | width]) & mask;
+      block[k] ^= swapped << width;
+      block[k | width] ^= swapped;
+    }
+  }
+}
+
+unsigned int getPenaltyScore(const QrCode *qrcode) {
+  unsigned int sideLength = qrcode->sideLength;
+  unsigned int numBlocks = (sideLength + 63) / 64;
+  unsigned int numWords = (sideLength + 8 + 63) / 64;
+  const uint64_t(*rows)[MODULE_ROW_WORDS] = qrcode->modules;
+
+  // The columns are the rows of the transposed symbol, built 64x64 modules
+  // at a time.
+  uint64_t columns[64 * MODULE_ROW_WORDS][MODULE_ROW_WORDS] = {0};
+  for (unsigned int i = 0; i < numBlocks; i++) {
+    for (unsigned int j = 0; j < numBlocks; j++) {
+      uint64_t block[64];
+      for (unsigned int k = 0; k < 64; k++) {
+        unsigned int row = 64 * i + k;
+        block[k] = row < sideLength ? rows[row][j] : 0;
+      }
+      transposeBlock(block);
+      for (unsigned int k = 0; k < 64; k++) {
+        columns[64 * j + k][i] = block[k];
       }
     }
   }
+
+  unsigned int penalty = 0;
+  unsigned int numDarkModules = 0;
+  for (unsigned int i = 0; i < sideLength; i++) {
+    penalty += getLinePenalty(rows[i], sideLength, numWords);
+    penalty += getLinePenalty(columns[i], sideLength, numWords);
+    for (unsigned int w = 0; w < numBlocks; w++) {
+      numDarkModules += countBits(rows[i][w]);
+    }
+  }
+
+  // Rule 2: every 2x2 block of modules of the same color. Bit j is the block
+  // whose top left module is in column j.
+  for (unsigned int row = 0; row + 1 < sideLength; row++) {
+    uint64_t sameVertically[MODULE_ROW_WORDS];
+    for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+      sameVertically[w] = ~(rows[row][w] ^ rows[row + 1][w]);
+    }
+    for (unsigned int w = 0; w < numBlocks; w++) {
+      uint64_t sameHorizontally =
+          ~(rows[row][w] ^ getShiftedWord(rows[row], w, 1));
+      uint64_t blocks = sameVertically[w] &
+                        getShiftedWord(sameVertically, w, 1) &
+                        sameHorizontally & getLineMask(w, sideLength - 1);
+      penalty += PENALTY_N2 * countBits(blocks);
+    }
+  }
+
+  // Rule 4: N4 points for every full 5% of dark modules away from 50%. The
+  // number of modules is odd, so the deviation is never 0.
+  unsigned int numModules = sideLength * sideLength;
+  unsigned int deviation =
+      abs((int)(numDarkModules * 20) - (int)(numModules * 10));
+  penalty += ((deviation + numModules - 1) / numModules - 1) * PENALTY_N4;
+  return penalty;
 }
+// Masking --------------------------------------------------------------------
 
-void writeHorizontalTimingPattern(unsigned int row, unsigned int startColumn,
-                                  unsigned int endColumn) {
+static void writeHorizontalTimingPattern(QrCode *qrcode, unsigned int row,
+                                         unsigned int startColumn,
+                                         unsigned int endColumn) {
   bool isBlack = true;
   for (unsigned int i = startColumn; i <= endColumn; i++) {
-    qrcode[row][i] = isBlack;
+    setFunctionModule(qrcode, row, i, isBlack);
     isBlack = !isBlack;
   }
 }
 
-void writeVerticalTimingPattern(unsigned int column, unsigned int startRow,
-                                unsigned int endRow) {
+static void writeVerticalTimingPattern(QrCode *qrcode, unsigned int column,
+                                       unsigned int startRow,
+                                       unsigned int endRow) {
   bool isBlack = true;
   for (unsigned int i = startRow; i <= endRow; i++) {
-    qrcode[i][column] = isBlack;
+    setFunctionModule(qrcode, i, column, isBlack);
     isBlack = !isBlack;
   }
 }
 
-void writeFinderPattern(unsigned int startRow, unsigned int startColumn) {
-  for (unsigned int i = 0; i < FINDER_PATTERN_SIZE_LENGTH; i++) {
-    for (unsigned int j = 0; j < FINDER_PATTERN_SIZE_LENGTH; j++) {
-      qrcode[startRow + i][startColumn + j] = finderPattern[i][j];
+// Writes a finder pattern and the white separator around it.
+static void writeFinderPattern(QrCode *qrcode, int startRow, int startColumn) {
+  int sideLength = qrcode->sideLength;
+  for (int i = -1; i <= FINDER_PATTERN_SIZE_LENGTH; i++) {
+    for (int j = -1; j <= FINDER_PATTERN_SIZE_LENGTH; j++) {
+      int row = startRow + i;
+      int column = startColumn + j;
+      if (row < 0 || row >= sideLength || column < 0 || column >= sideLength) {
+        continue;
+      }
+      bool isSeparator = i < 0 || i >= FINDER_PATTERN_SIZE_LENGTH || j < 0 ||
+                         j >= FINDER_PATTERN_SIZE_LENGTH;
+      setFunctionModule(qrcode, row, column,
+                        !isSeparator && finderPattern[i][j]);
     }
   }
 }
 
-void writeFinderPatterns(unsigned int sideLength) {
-  writeFinderPattern(0, 0);
-  writeFinderPattern(0, sideLength - FINDER_PATTERN_SIZE_LENGTH);
-  writeFinderPattern(sideLength - FINDER_PATTERN_SIZE_LENGTH, 0);
+void writeFinderPatterns(QrCode *qrcode) {
+  unsigned int sideLength = qrcode->sideLength;
+  writeFinderPattern(qrcode, 0, 0);
+  writeFinderPattern(qrcode, 0, sideLength - FINDER_PATTERN_SIZE_LENGTH);
+  writeFinderPattern(qrcode, sideLength - FINDER_PATTERN_SIZE_LENGTH, 0);
 }
 
-int main(int argc, char *argv[]) {
-  if (argc < 2) {
-    printf("Supply a string to be encoded in the QR Code\n");
-    return 1;
+void writeTimingPatterns(QrCode *qrcode) {
+  unsigned int sideLength = qrcode->sideLength;
+  writeHorizontalTimingPattern(qrcode, FINDER_PATTERN_SIZE_LENGTH - 1,
+                               FINDER_PATTERN_SIZE_LENGTH + 1,
+                               sideLength - FINDER_PATTERN_SIZE_LENGTH - 2);
+  writeVerticalTimingPattern(qrcode, FINDER_PATTERN_SIZE_LENGTH - 1,
+                             FINDER_PATTERN_SIZE_LENGTH + 1,
+                             sideLength - FINDER_PATTERN_SIZE_LENGTH - 2);
+}
+
+void writeAlignmentPatterns(QrCode *qrcode) {
+  unsigned int positions[MAX_ALIGNMENT_PATTERNS];
+  unsigned int numPositions =
+      getAlignmentPatternPositions(qrcode->version, positions);
+
+  for (unsigned int i = 0; i < numPositions; i++) {
+    for (unsigned int j = 0; j < numPositions; j++) {
+      // Skip the three corners taken by the finder patterns.
+      if ((i == 0 && j == 0) || (i == 0 && j == numPositions - 1) ||
+          (i == numPositions - 1 && j == 0)) {
+        continue;
+      }
+
+      // 5x5 dark square with a 3x3 light ring around the dark center.
+      for (int dy = -2; dy <= 2; dy++) {
+        for (int dx = -2; dx <= 2; dx++) {
+          bool isRing = abs(dy) <= 1 && abs(dx) <= 1 && (dy != 0 || dx != 0);
+          setFunctionModule(qrcode, positions[i] + dy, positions[j] + dx,
+                            !isRing);
+        }
+      }
+    }
   }
+}
 
-  initGfLookupTables();
+static void setVersion(QrCode *qrcode, unsigned int version,
+                       ErrorCorrectionLevel errorCorrectionLevel) {
+  qrcode->version = version;
+  qrcode->errorCorrectionLevel = errorCorrectionLevel;
+  qrcode->maskPattern = 0;
+  qrcode->sideLength = getSideLength(version);
+}
 
-  writeFinderPatterns(VERSION_1_SIDE_LENGTH);
+void initQrCode(QrCode *qrcode, unsigned int version,
+                ErrorCorrectionLevel errorCorrectionLevel) {
+  setVersion(qrcode, version, errorCorrectionLevel);
+  memset(qrcode->modules, 0, sizeof(qrcode->modules));
+  memset(qrcode->functionModules, 0, sizeof(qrcode->functionModules));
+}
 
-  writeHorizontalTimingPattern(
-      FINDER_PATTERN_SIZE_LENGTH - 1, FINDER_PATTERN_SIZE_LENGTH + 1,
-      VERSION_1_SIDE_LENGTH - FINDER_PATTERN_SIZE_LENGTH);
-  writeVerticalTimingPattern(
-      FINDER_PATTERN_SIZE_LENGTH - 1, FINDER_PATTERN_SIZE_LENGTH + 1,
-      VERSION_1_SIDE_LENGTH - FINDER_PATTERN_SIZE_LENGTH);
+// Version templates ----------------------------------------------------------
+
+// Everything about the layout of a symbol that only depends on its version:
+// the function patterns, with room for the format information, the module
+// each bit of the codewords is placed in and the mask patterns. Built on
+// first use of the version and immutable afterwards.
+typedef struct {
+  uint64_t modules[MAX_SIDE_LENGTH][MODULE_ROW_WORDS];
+  uint64_t functionModules[MAX_SIDE_LENGTH][MODULE_ROW_WORDS];
+  // Modules inverted by each mask pattern, already restricted to the data
+  // modules, in the same layout as the modules.
+  uint64_t maskPlanes[NUM_MASK_PATTERNS][MAX_SIDE_LENGTH][MODULE_ROW_WORDS];
+  // Row (high byte) and column (low byte) of the module of each bit of the
+  // codewords, in placement order.
+  uint16_t bitPositions[MAX_CODEWORDS * 8];
+} VersionTemplate;
+
+static VersionTemplate versionTemplates[MAX_VERSION + 1];
+static atomic_bool versionTemplateReady[MAX_VERSION + 1];
+static pthread_mutex_t versionTemplatesLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void buildVersionTemplate(VersionTemplate *template,
+                                 unsigned int version) {
+  // The patterns are drawn by the regular writers on a scratch symbol. The
+  // format information written here is replaced for every symbol.
+  QrCode qrcode;
+  initQrCode(&qrcode, version, ERROR_CORRECTION_LEVEL_L);
+  writeFinderPatterns(&qrcode);
+  writeTimingPatterns(&qrcode);
+  writeAlignmentPatterns(&qrcode);
+  writeVersionInformation(&qrcode);
+  writeFormatInformation(&qrcode);
+  writeDarkModule(&qrcode);
+  memcpy(template->modules, qrcode.modules, sizeof(template->modules));
+  memcpy(template->functionModules, qrcode.functionModules,
+         sizeof(template->functionModules));
+
+  // Bits are placed in pairs of columns, starting from the bottom right
+  // corner and going up and down alternately, skipping function modules. The
+  // vertical timing pattern column is skipped entirely. Modules left once all
+  // the bits are placed are the remainder bits, which stay light.
+  unsigned int sideLength = qrcode.sideLength;
+  size_t numBits = getNumCodewords(version) * 8;
+  size_t bitIndex = 0;
+  for (int right = sideLength - 1; right >= 1; right -= 2) {
+    if (right == FINDER_PATTERN_SIZE_LENGTH - 1) {
+      right--;
+    }
+    bool upwards = ((right + 1) & 2) == 0;
+    for (unsigned int i = 0; i < sideLength; i++) {
+      unsigned int row = upwards ? sideLength - 1 - i : i;
+      for (int column = right; column >= right - 1; column--) {
+        if (isFunctionModule(&qrcode, row, column) || bitIndex == numBits) {
+          continue;
+        }
+        template->bitPositions[bitIndex++] = row << 8 | column;
+      }
+    }
+  }
 
-  // Alignment patterns are present only in QR Code symbols of version 2 or
-  // larger. Therefore, they are skipped here for now.
+  // Function modules and the bits past the side length are never masked.
+  for (unsigned int maskPattern = 0; maskPattern < NUM_MASK_PATTERNS;
+       maskPattern++) {
+    for (unsigned int row = 0; row < sideLength; row++) {
+      for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+        template->maskPlanes[maskPattern][row][w] =
+            getMaskWord(maskPattern, row, w) &
+            ~template->functionModules[row][w] & getLineMask(w, sideLength);
+      }
+    }
+  }
+}
 
-  size_t codewordsSize = 19;
-  const unsigned char *input = (const unsigned char *)argv[1];
-  unsigned char *encodedString = encodeString(input, codewordsSize);
-  if (encodedString == NULL) {
-    return 1;
+static const VersionTemplate *getVersionTemplate(unsigned int version) {
+  if (!atomic_load_explicit(&versionTemplateReady[version],
+                            memory_order_acquire)) {
+    pthread_mutex_lock(&versionTemplatesLock);
+    if (!atomic_load_explicit(&versionTemplateReady[version],
+                              memory_order_relaxed)) {
+      buildVersionTemplate(&versionTemplates[version], version);
+      atomic_store_explicit(&versionTemplateReady[version], true,
+                            memory_order_release);
+    }
+    pthread_mutex_unlock(&versionTemplatesLock);
   }
+  return &versionTemplates[version];
+}
+
+// Resets the symbol to the function patterns of its version, copied from the
+// template instead of being drawn module by module.
+static void loadVersionTemplate(QrCode *qrcode, unsigned int version,
+                                ErrorCorrectionLevel errorCorrectionLevel) {
+  const VersionTemplate *template = getVersionTemplate(version);
+  setVersion(qrcode, version, errorCorrectionLevel);
+  size_t rowsSize = qrcode->sideLength * sizeof(qrcode->modules[0]);
+  memcpy(qrcode->modules, template->modules, rowsSize);
+  memcpy(qrcode->functionModules, template->functionModules, rowsSize);
+}
 
-  unsigned char *errorCorrectionCodeWords =
-      createErrorCorrectionCodewords(encodedString, codewordsSize, 7);
-  if (errorCorrectionCodeWords == NULL) {
-    free(encodedString);
-    return 1;
+void writeEncodedString(QrCode *qrcode, const unsigned char *encodedStr,
+                        size_t encodedStrLength) {
+  const uint16_t *bitPositions =
+      getVersionTemplate(qrcode->version)->bitPositions;
+  for (size_t i = 0; i < encodedStrLength; i++) {
+    const uint16_t *positions = &bitPositions[i * 8];
+    for (unsigned int j = 0; j < 8; j++) {
+      unsigned int row = positions[j] >> 8;
+      unsigned int column = positions[j] & 0xff;
+      uint64_t isBlack = (encodedStr[i] >> (7 - j)) & 1;
+      qrcode->modules[row][column / 64] |= isBlack << (column % 64);
+    }
   }
+}
 
-  size_t errorCorrectedEncodedStringLength = codewordsSize + 7;
-  unsigned char *errorCorrectedEncodedString = (unsigned char *)calloc(
-      errorCorrectedEncodedStringLength, sizeof(unsigned char));
-  if (errorCorrectedEncodedString == NULL) {
-    free(encodedString);
-    free(errorCorrectionCodeWords);
-    return 1;
+void applyMaskPattern(QrCode *qrcode, unsigned int maskPattern) {
+  const uint64_t(*maskPlane)[MODULE_ROW_WORDS] =
+      getVersionTemplate(qrcode->version)->maskPlanes[maskPattern];
+  for (unsigned int row = 0; row < qrcode->sideLength; row++) {
+    for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+      qrcode->modules[row][w] ^= maskPlane[row][w];
+    }
   }
+}
 
-  memcpy(errorCorrectedEncodedString, encodedString, codewordsSize);
-  memcpy(errorCorrectedEncodedString + codewordsSize, errorCorrectionCodeWords,
-         7);
+// Version templates ----------------------------------------------------------
 
-  writeEncodedString(VERSION_1_SIDE_LENGTH, errorCorrectedEncodedString,
-                     errorCorrectedEncodedStringLength);
+bool encodeQrCode(QrCode *qrcode, const unsigned char *str, size_t strLength,
+                  ErrorCorrectionLevel errorCorrectionLevel) {
+  if (!isValidUtf8(str, strLength)) {
+    fprintf(stderr, "Input string is not valid UTF-8\n");
+    return false;
+  }
+  // The segmentation of the string is kept from the version selection.
+  unsigned char modes[MAX_STRING_LENGTH];
+  unsigned int version =
+      selectVersion(str, strLength, errorCorrectionLevel, modes);
+  if (version == 0) {
+    fprintf(stderr, "Input string too long: %zu\n", strLength);
+    return false;
+  }
+  loadVersionTemplate(qrcode, version, errorCorrectionLevel);
+
+  // Everything is encoded in the buffers of the QrCode, without any
+  // allocation.
+  writeSegments(str, strLength, modes, version, qrcode->dataCodewords,
+                getNumDataCodewords(version, errorCorrectionLevel));
+  writeErrorCorrectionBlocks(qrcode);
+
+  writeEncodedString(qrcode, qrcode->codewords, getNumCodewords(version));
+
+  // Every mask pattern is tried on the complete symbol, format information
+  // included, and the one with the lowest penalty is kept, see 7.8.3.
+  // Masking twice with the same pattern restores the unmasked symbol.
+  unsigned int bestMaskPattern = 0;
+  unsigned int bestPenalty = UINT_MAX;
+  for (unsigned int maskPattern = 0; maskPattern < NUM_MASK_PATTERNS;
+       maskPattern++) {
+    qrcode->maskPattern = maskPattern;
+    applyMaskPattern(qrcode, maskPattern);
+    writeFormatInformation(qrcode);
+    unsigned int penalty = getPenaltyScore(qrcode);
+    if (penalty < bestPenalty) {
+      bestMaskPattern = maskPattern;
+      bestPenalty = penalty;
+    }
+    applyMaskPattern(qrcode, maskPattern);
+  }
 
-  free(encodedString);
-  free(errorCorrectionCodeWords);
-  free(errorCorrectedEncodedString);
+  qrcode->maskPattern = bestMaskPattern;
+  applyMaskPattern(qrcode, bestMaskPattern);
+  writeFormatInformation(qrcode);
+  return true;
+}
 
-  applyMaskPattern(VERSION_1_SIDE_LENGTH);
+// Rendering ------------------------------------------------------------------
 
-  writeFormatInformation(VERSION_1_SIDE_LENGTH);
-  writeDarkModule(VERSION);
+// Glyphs of the compact text format, indexed by the color of the top module
+// (bit 0) and of the bottom module (bit 1) they stand for.
+static const char *const HALF_BLOCKS[4] = {" ", "▀", "▄", "█"};
+static const size_t HALF_BLOCK_LENGTHS[4] = {1, 3, 3, 3};
 
-  render(VERSION_1_SIDE_LENGTH, QUIET_ZONE_SIZE);
-  return 0;
+static size_t countDarkModules(const QrCode *qrcode) {
+  size_t numDarkModules = 0;
+  for (unsigned int row = 0; row < qrcode->sideLength; row++) {
+    for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+      numDarkModules += countBits(qrcode->modules[row][w]);
+    }
+  }
+  return numDarkModules;
+}
+
+static char *writeLightModules(char *buffer, size_t numModules) {
+  for (size_t i = 0; i < numModules; i++) {
+    memcpy(buffer, MODULE_WHITE, MODULE_WHITE_LENGTH);
+    buffer += MODULE_WHITE_LENGTH;
+  }
+  return buffer;
+}
+
+static size_t getTextSize(const QrCode *qrcode, unsigned int quietZoneSize) {
+  // Every module is light but the dark ones, plus a newline per row.
+  size_t withQuietZoneSize = qrcode->sideLength + 2 * (size_t)quietZoneSize;
+  return withQuietZoneSize * withQuietZoneSize * MODULE_WHITE_LENGTH +
+         countDarkModules(qrcode) *
+             (MODULE_BLACK_LENGTH - MODULE_WHITE_LENGTH) +
+         withQuietZoneSize;
+}
+
+static size_t renderText(const QrCode *qrcode, unsigned int quietZoneSize,
+                         char *buffer) {
+  unsigned int sideLength = qrcode->sideLength;
+  size_t withQuietZoneSize = sideLength + 2 * (size_t)quietZoneSize;
+  char *end = buffer;
+
+  // All the rows of the quiet zone are the same: the first one is written
+  // module by module and the others are copies of it.
+  const char *quietZoneRow = end;
+  size_t quietZoneRowLength = withQuietZoneSize * MODULE_WHITE_LENGTH + 1;
+  for (unsigned int i = 0; i < quietZoneSize; i++) {
+    if (i == 0) {
+      end = writeLightModules(end, withQuietZoneSize);
+      *end++ = '\n';
+    } else {
+      memcpy(end, quietZoneRow, quietZoneRowLength);
+      end += quietZoneRowLength;
+    }
+  }
+
+  for (unsigned int row = 0; row < sideLength; row++) {
+    end = writeLightModules(end, quietZoneSize);
+    for (unsigned int column = 0; column < sideLength; column++) {
+      if (getModule(qrcode, row, column)) {
+        memcpy(end, MODULE_BLACK, MODULE_BLACK_LENGTH);
+        end += MODULE_BLACK_LENGTH;
+      } else {
+        memcpy(end, MODULE_WHITE, MODULE_WHITE_LENGTH);
+        end += MODULE_WHITE_LENGTH;
+      }
+    }
+    end = writeLightModules(end, quietZoneSize);
+    *end++ = '\n';
+  }
+
+  for (unsigned int i = 0; i < quietZoneSize; i++) {
+    memcpy(end, quietZoneRow, quietZoneRowLength);
+    end += quietZoneRowLength;
+  }
+  return end - buffer;
+}
+
+// Reads the row of modules at the given index, counting the quiet zone: rows
+// of the quiet zone and past the bottom of the last line are light.
+static const uint64_t *getQuietZoneRow(const QrCode *qrcode,
+                                       unsigned int quietZoneSize,
+                                       unsigned int index) {
+  static const uint64_t LIGHT_ROW[MODULE_ROW_WORDS] = {0};
+  if (index < quietZoneSize || index - quietZoneSize >= qrcode->sideLength) {
+    return LIGHT_ROW;
+  }
+  return qrcode->modules[index - quietZoneSize];
+}
+
+static size_t getCompactTextSize(const QrCode *qrcode,
+                                 unsigned int quietZoneSize) {
+  // One byte per cell, two more for the cells with a dark module, plus a
+  // newline per line.
+  size_t withQuietZoneSize = qrcode->sideLength + 2 * (size_t)quietZoneSize;
+  size_t numLines = (withQuietZoneSize + 1) / 2;
+  size_t numDarkCells = 0;
+  for (size_t line = 0; line < numLines; line++) {
+    const uint64_t *top = getQuietZoneRow(qrcode, quietZoneSize, 2 * line);
+    const uint64_t *bottom =
+        getQuietZoneRow(qrcode, quietZoneSize, 2 * line + 1);
+    for (unsigned int w = 0; w < MODULE_ROW_WORDS; w++) {
+      numDarkCells += countBits(top[w] | bottom[w]);
+    }
+  }
+  return numLines * (withQuietZoneSize + 1) + 2 * numDarkCells;
+}
+
+static size_t renderCompactText(const QrCode *qrcode,
+                                unsigned int quietZoneSize, char *buffer) {
+  unsigned int sideLength = qrcode->sideLength;
+  size_t withQuietZoneSize = sideLength + 2 * (size_t)quietZoneSize;
+  size_t numLines = (withQuietZoneSize + 1) / 2;
+  char *end = buffer;
+
+  for (size_t line = 0; line < numLines; line++) {
+    const uint64_t *top = getQuietZoneRow(qrcode, quietZoneSize, 2 * line);
+    const uint64_t *bottom =
+        getQuietZoneRow(qrcode, quietZoneSize, 2 * line + 1);
+    memset(end, ' ', quietZoneSize);
+    end += quietZoneSize;
+    for (unsigned int column = 0; column < sideLength; column++) {
+      unsigned int glyph = ((top[column / 64] >> (column % 64)) & 1) |
+                           ((bottom[column / 64] >> (column % 64)) & 1) << 1;
+      memcpy(end, HALF_BLOCKS[glyph], HALF_BLOCK_LENGTHS[glyph]);
+      end += HALF_BLOCK_LENGTHS[glyph];
+    }
+    memset(end, ' ', quietZoneSize);
+    end += quietZoneSize;
+    *end++ = '\n';
+  }
+  return end - buffer;
+}
+
+// Images are rasterized one row of modules at a time: its first row of pixels
+// is expanded from the modules and the other scale - 1 are copies of it.
+
+// Bytes of pixels of a 1-bit row, padded to a whole byte.
+static size_t getBitRowSize(size_t side) { return (side + 7) / 8; }
+
+size_t getImageSide(const QrCode *qrcode, const RenderOptions *options) {
+  return (qrcode->sideLength + 2 * (size_t)options->quietZoneSize) *
+         options->scale;
+}
+
+// Sets the bits from start (included) to end (excluded) of a 1-bit row, a
+// whole byte at a time where possible.
+static void setPixels(unsigned char *row, size_t start, size_t end) {
+  for (; start < end && start % 8 != 0; start++) {
+    row[start / 8] |= 0x80 >> (start % 8);
+  }
+  size_t numBytes = (end - start) / 8;
+  memset(row + start / 8, 0xff, numBytes);
+  for (start += 8 * numBytes; start < end; start++) {
+    row[start / 8] |= 0x80 >> (start % 8);
+  }
+}
+
+// Fills spreadTable[b] with the scale bytes of pixels of the 8 modules of
+// the byte b, the leftmost in its least significant bit as in QrCode.modules,
+// so that a row of modules is expanded a byte at a time.
+static void buildSpreadTable(unsigned int scale, unsigned char lightByte,
+                             unsigned char spreadTable[256][MAX_SCALE]) {
+  memset(spreadTable[0], 0, scale);
+  for (unsigned int b = 1; b < 256; b++) {
+    unsigned int module = 0;
+    while (!((b >> module) & 1)) {
+      module++;
+    }
+    // The pixels of b are those of its leftmost dark module and of the
+    // others, both already in the table unless b has a single dark module.
+    unsigned int others = b & (b - 1);
+    if (others == 0) {
+      memset(spreadTable[b], 0, scale);
+      setPixels(spreadTable[b], module * scale, (module + 1) * scale);
+      continue;
+    }
+    for (unsigned int i = 0; i < scale; i++) {
+      spreadTable[b][i] = spreadTable[b ^ others][i] | spreadTable[others][i];
+    }
+  }
+  if (lightByte != 0) {
+    for (unsigned int b = 0; b < 256; b++) {
+      for (unsigned int i = 0; i < scale; i++) {
+        spreadTable[b][i] ^= lightByte;
+      }
+    }
+  }
+}
+
+// Writes the first row of pixels of the given row of modules (counting the
+// quiet zone). The quiet zone is filled with lightByte a whole byte at a time
+// where possible; the rest of the row goes through the spread table.
+static void writeBitRow(const QrCode *qrcode, const RenderOptions *options,
+                        unsigned int index, unsigned char lightByte,
+                        unsigned char spreadTable[256][MAX_SCALE],
+                        unsigned char *row) {
+  unsigned int sideLength = qrcode->sideLength;
+  unsigned int scale = options->scale;
+  size_t rowSize = getBitRowSize(getImageSide(qrcode, options));
+  if (index < options->quietZoneSize ||
+      index - options->quietZoneSize >= sideLength) {
+    memset(row, lightByte, rowSize);
+    return;
+  }
+
+  // 8 light modules always take scale whole bytes.
+  size_t leadingSize = (size_t)(options->quietZoneSize / 8) * scale;
+  memset(row, lightByte, leadingSize);
+
+  // The rest of the row is expanded 8 modules at a time, starting with the
+  // remaining modules of the quiet zone.
+  const uint64_t *modules = qrcode->modules[index - options->quietZoneSize];
+  unsigned int offset = options->quietZoneSize % 8;
+  unsigned char *end = row + leadingSize;
+  for (unsigned int start = 0; start < offset + sideLength; start += 8) {
+    unsigned int b =
+        start < offset
+            ? (unsigned int)(modules[0] << offset) & 0xff
+            : (unsigned int)getShiftedWord(modules, (start - offset) / 64,
+                                           (start - offset) % 64) &
+                  0xff;
+    // The last byte may reach past the end of a row with a small quiet zone.
+    size_t length = scale < row + rowSize - end ? scale : row + rowSize - end;
+    memcpy(end, spreadTable[b], length);
+    end += length;
+  }
+  memset(end, lightByte, row + rowSize - end);
 }
+
+void rasterizeQrCode(const QrCode *qrcode, const RenderOptions *options,
+                     bool invert, unsigned char *pixels, size_t stride) {
+  unsigned char spreadTable[256][MAX_SCALE];
+  unsigned char lightByte = invert ? 0xff : 0x00;
+  buildSpreadTable(options->scale, lightByte, spreadTable);
+  size_t rowSize = getBitRowSize(getImageSide(qrcode, options));
+  unsigned int numRows = qrcode->sideLength + 2 * options->quietZoneSize;
+  for (unsigned int index = 0; index < numRows; index++) {
+    writeBitRow(qrcode, options, index, lightByte, spreadTable, pixels);
+    for (unsigned int i = 1; i < options->scale; i++) {
+      memcpy(pixels + i * stride, pixels, rowSize);
+    }
+    pixels += options->scale * stride;
+  }
+}
+
+// Netpbm images are a short text header followed by the raster, one row of
+// pixels after the other from the top, see netpbm(5).
+
+// Writes the header of a binary PBM (P4) or PGM (P5) image of the given side
+// into buffer, if not NULL, and returns its length.
+static size_t writeNetpbmHeader(OutputFormat format, size_t side,
+                                char *buffer) {
+  char header[64];
+  int length = format == OUTPUT_FORMAT_PBM
+                   ? snprintf(header, sizeof(header), "P4\n%zu %zu\n", side,
+                              side)
+                   : snprintf(header, sizeof(header), "P5\n%zu %zu\n255\n",
+                              side, side);
+  if (buffer != NULL) {
+    memcpy(buffer, header, length);
+  }
+  return length;
+}
+
+static size_t getNetpbmSize(const QrCode *qrcode,
+                            const RenderOptions *options) {
+  size_t side = getImageSide(qrcode, options);
+  size_t rowSize =
+      options->format == OUTPUT_FORMAT_PBM ? getBitRowSize(side) : side;
+  return writeNetpbmHeader(options->format, side, NULL) + side * rowSize;
+}
+
+// Writes the scale rows of pixels of the given row of modules (counting the
+// quiet zone) of a PGM, where 0 is black and 255 is white, and returns their
+// end. Every run of dark modules is filled at once.
+static char *writePgmRows(const QrCode *qrcode, const RenderOptions *options,
+                          unsigned int index, char *buffer) {
+  const uint64_t *modules =
+      getQuietZoneRow(qrcode, options->quietZoneSize, index);
+  size_t rowSize = getImageSide(qrcode, options);
+  memset(buffer, 255, rowSize);
+  unsigned int column = 0;
+  while (column < qrcode->sideLength) {
+    if (!((modules[column / 64] >> (column % 64)) & 1)) {
+      column++;
+      continue;
+    }
+    unsigned int start = column;
+    while (column < qrcode->sideLength &&
+           ((modules[column / 64] >> (column % 64)) & 1)) {
+      column++;
+    }
+    memset(buffer + (options->quietZoneSize + (size_t)start) * options->scale,
+           0, (size_t)(column - start) * options->scale);
+  }
+  for (unsigned int i = 1; i < options->scale; i++) {
+    memcpy(buffer + i * rowSize, buffer, rowSize);
+  }
+  return buffer + options->scale * rowSize;
+}
+
+static size_t renderNetpbm(const QrCode *qrcode, const RenderOptions *options,
+                           char *buffer) {
+  size_t side = getImageSide(qrcode, options);
+  char *end = buffer + writeNetpbmHeader(options->format, side, buffer);
+  if (options->format == OUTPUT_FORMAT_PBM) {
+    // In PBM, 1 is black.
+    size_t rowSize = getBitRowSize(side);
+    rasterizeQrCode(qrcode, options, false, (unsigned char *)end, rowSize);
+    return end + side * rowSize - buffer;
+  }
+  unsigned int numRows = qrcode->sideLength + 2 * options->quietZoneSize;
+  for (unsigned int index = 0; index < numRows; index++) {
+    end = writePgmRows(qrcode, options, index, end);
+  }
+  return end - buffer;
+}
+
+// PNG images are rasterized into scanlines placed right after the
+// getPngMaxSize bytes the PNG may take, which are then compressed to the
+// start of the buffer.
+
+static size_t getPngSize(const QrCode *qrcode, const RenderOptions *options) {
+  uint32_t side = (uint32_t)getImageSide(qrcode, options);
+  return getPngMaxSize(side, side, options->pngCompression) +
+         getPngScanlinesSize(side, side);
+}
+
+static size_t renderPng(const QrCode *qrcode, const RenderOptions *options,
+                        char *buffer) {
+  uint32_t side = (uint32_t)getImageSide(qrcode, options);
+  unsigned char *png = (unsigned char *)buffer;
+  unsigned char *scanlines =
+      png + getPngMaxSize(side, side, options->pngCompression);
+  size_t scanlineSize = getPngScanlinesSize(side, 1);
+  // Every scanline starts with its filter type, none, and 0 is black.
+  rasterizeQrCode(qrcode, options, true, scanlines + 1, scanlineSize);
+  for (uint32_t y = 0; y < side; y++) {
+    scanlines[y * scanlineSize] = 0;
+  }
+  return writePng(scanlines, side, side, options->pngCompression, png);
+}
+
+// SVG images draw the dark modules with a single path, on top of a light
+// background. Every horizontal run of dark modules is a single rectangle,
+// "m<dx> <dy>h<length>v1h-<length>z", whose first move is relative to the
+// top left corner of the previous one (or to the origin).
+
+static const char SVG_FOOTER[] = "\"/></svg>\n";
+#define SVG_FOOTER_LENGTH (sizeof(SVG_FOOTER) - 1)
+
+// Writes value in decimal and returns its end.
+static char *writeInteger(char *buffer, long value) {
+  char digits[24];
+  size_t numDigits = 0;
+  unsigned long magnitude =
+      value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+  do {
+    digits[numDigits++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude > 0);
+  if (value < 0) {
+    *buffer++ = '-';
+  }
+  while (numDigits > 0) {
+    *buffer++ = digits[--numDigits];
+  }
+  return buffer;
+}
+
+// Writes the header of an SVG image into buffer, if not NULL, and returns its
+// length. It opens the path of the dark modules.
+static size_t writeSvgHeader(const QrCode *qrcode,
+                             const RenderOptions *options, char *buffer) {
+  char header[256];
+  size_t side = qrcode->sideLength + 2 * (size_t)options->quietZoneSize;
+  int length = snprintf(
+      header, sizeof(header),
+      "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 %zu %zu\" "
+      "width=\"%zu\" height=\"%zu\" shape-rendering=\"crispEdges\">"
+      "<rect width=\"100%%\" height=\"100%%\" fill=\"#fff\"/><path d=\"",
+      side, side, side * options->scale, side * options->scale);
+  if (buffer != NULL) {
+    memcpy(buffer, header, length);
+  }
+  return length;
+}
+
+// Writes the rectangles of the runs of dark modules into buffer, if not NULL,
+// and returns their length.
+static size_t writeSvgRuns(const QrCode *qrcode, unsigned int quietZoneSize,
+                           char *buffer) {
+  unsigned int sideLength = qrcode->sideLength;
+  size_t length = 0;
+  long x = 0;
+  long y = 0;
+  for (unsigned int row = 0; row < sideLength; row++) {
+    const uint64_t *modules = qrcode->modules[row];
+    unsigned int column = 0;
+    while (column < sideLength) {
+      if (!((modules[column / 64] >> (column % 64)) & 1)) {
+        column++;
+        continue;
+      }
+      unsigned int start = column;
+      while (column < sideLength &&
+             ((modules[column / 64] >> (column % 64)) & 1)) {
+        column++;
+      }
+      long runX = (long)quietZoneSize + start;
+      long runY = (long)quietZoneSize + row;
+      char run[64];
+      char *end = run;
+      *end++ = 'm';
+      end = writeInteger(end, runX - x);
+      *end++ = ' ';
+      end = writeInteger(end, runY - y);
+      *end++ = 'h';
+      end = writeInteger(end, column - start);
+      memcpy(end, "v1h-", 4);
+      end = writeInteger(end + 4, column - start);
+      *end++ = 'z';
+      if (buffer != NULL) {
+        memcpy(buffer + length, run, end - run);
+      }
+      length += end - run;
+      x = runX;
+      y = runY;
+    }
+  }
+  return length;
+}
+
+static size_t getSvgSize(const QrCode *qrcode, const RenderOptions *options) {
+  return writeSvgHeader(qrcode, options, NULL) +
+         writeSvgRuns(qrcode, options->quietZoneSize, NULL) + SVG_FOOTER_LENGTH;
+}
+
+static size_t renderSvg(const QrCode *qrcode, const RenderOptions *options,
+                        char *buffer) {
+  char *end = buffer + writeSvgHeader(qrcode, options, buffer);
+  end += writeSvgRuns(qrcode, options->quietZoneSize, end);
+  memcpy(end, SVG_FOOTER, SVG_FOOTER_LENGTH);
+  return end + SVG_FOOTER_LENGTH - buffer;
+}
+
+size_t getRenderedSize(const QrCode *qrcode, const RenderOptions *options) {
+  switch (options->format) {
+    case OUTPUT_FORMAT_COMPACT_TEXT:
+      return getCompactTextSize(qrcode, options->quietZoneSize);
+    case OUTPUT_FORMAT_PBM:
+    case OUTPUT_FORMAT_PGM:
+      return getNetpbmSize(qrcode, options);
+    case OUTPUT_FORMAT_PNG:
+      return getPngSize(qrcode, options);
+    case OUTPUT_FORMAT_SVG:
+      return getSvgSize(qrcode, options);
+    default:
+      return getTextSize(qrcode, options->quietZoneSize);
+  }
+}
+
+size_t renderInto(const QrCode *qrcode, const RenderOptions *options,
+                  char *buffer) {
+  switch (options->format) {
+    case OUTPUT_FORMAT_COMPACT_TEXT:
+      return renderCompactText(qrcode, options->quietZoneSize, buffer);
+    case OUTPUT_FORMAT_PBM:
+    case OUTPUT_FORMAT_PGM:
+      return renderNetpbm(qrcode, options, buffer);
+    case OUTPUT_FORMAT_PNG:
+      return renderPng(qrcode, options, buffer);
+    case OUTPUT_FORMAT_SVG:
+      return renderSvg(qrcode, options, buffer);
+    default:
+      return renderText(qrcode, options->quietZoneSize, buffer);
+  }
+}
+
+bool render(const QrCode *qrcode, const RenderOptions *options, FILE *out) {
+  char *buffer = (char *)malloc(getRenderedSize(qrcode, options));
+  if (buffer == NULL) {
+    return false;
+  }
+  size_t size = renderInto(qrcode, options, buffer);
+  bool written = fwrite(buffer, 1, size, out) == size;
+  free(buffer);
+  return written;
+}
+
+// Rendering ------------------------------------------------------------------
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef QRENDER_H_
+#define QRENDER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "png.h"
+
+#define MIN_VERSION 1
+#define MAX_VERSION 40
+// Side length of a Version 40 symbol: 17 + 4 * 40.
+#define MAX_SIDE_LENGTH 177
+// Number of codewords (data and error correction) of a Version 40 symbol.
+#define MAX_CODEWORDS 3706
+// Number of codewords (data and error correction) of the longest error
+// correction block, over every version and error correction level.
+#define MAX_BLOCK_CODEWORDS 153
+#define QUIET_ZONE_SIZE 5
+// Largest side of a module in pixels.
+#define MAX_SCALE 256
+// 64-bit words holding a row of modules: MAX_SIDE_LENGTH bits, rounded up.
+#define MODULE_ROW_WORDS 3
+
+/** Error correction levels, see 6.5.1. Each one can recover from the loss of
+ * roughly 7%, 15%, 25% and 30% of the codewords respectively.
+ */
+typedef enum {
+  ERROR_CORRECTION_LEVEL_L,
+  ERROR_CORRECTION_LEVEL_M,
+  ERROR_CORRECTION_LEVEL_Q,
+  ERROR_CORRECTION_LEVEL_H,
+} ErrorCorrectionLevel;
+
+/** A QR Code symbol and the scratch space needed to build it.
+ *
+ * The context is owned by the caller and nothing in the library keeps global
+ * state about a symbol, so each thread can encode into its own QrCode without
+ * any locking. It is sized for the largest supported version, so encoding
+ * never allocates: a QrCode can live on the stack or in an arena and be
+ * reused for any number of symbols.
+ */
+typedef struct {
+  unsigned int version;
+  ErrorCorrectionLevel errorCorrectionLevel;
+  // Mask pattern reference (0 to 7) written in the format information.
+  unsigned int maskPattern;
+  unsigned int sideLength;
+  // Bit-packed rows of modules: the module in a given row and column is bit
+  // column % 64 of modules[row][column / 64], set if the module is dark. The
+  // bits past the side length are always 0.
+  uint64_t modules[MAX_SIDE_LENGTH][MODULE_ROW_WORDS];
+  // Modules of the function patterns (finder, timing and alignment patterns,
+  // format and version information), which are not used for data. Same
+  // layout as modules.
+  uint64_t functionModules[MAX_SIDE_LENGTH][MODULE_ROW_WORDS];
+  // Data codewords in the order they are encoded, before being split into
+  // error correction blocks.
+  unsigned char dataCodewords[MAX_CODEWORDS];
+  // Final sequence of codewords: the data codewords of every block
+  // interleaved, followed by their interleaved error correction codewords.
+  unsigned char codewords[MAX_CODEWORDS];
+} QrCode;
+
+/** Returns true if the module in the given row and column is dark. */
+static inline bool getModule(const QrCode *qrcode, unsigned int row,
+                             unsigned int column) {
+  return (qrcode->modules[row][column / 64] >> (column % 64)) & 1;
+}
+
+/** Ways of computing the GF(256) products needed by the Reed-Solomon encoder.
+ */
+typedef enum {
+  // exp(log(a) + log(b)), from the 768 bytes of generated tables.
+  GF_MUL_LOG_EXP,
+  // A 64 KiB table holding the product of every pair of elements.
+  GF_MUL_PRODUCT_TABLE,
+  // For each possible factor, its products with every coefficient of the
+  // generator polynomial, stored next to each other.
+  GF_MUL_GENERATOR_ROWS,
+  // Split-nibble products computed with pshufb on all the coefficients at
+  // once, using AVX2 or SSSE3 as detected at runtime. Falls back to
+  // GF_MUL_GENERATOR_ROWS on other CPUs. This is the default.
+  GF_MUL_SPLIT_NIBBLE,
+} GfMulBackend;
+
+/** Selects the backend used by createErrorCorrectionCodewords, building its
+ * tables if needed. Affects the whole process: call it before encoding.
+ */
+void setGfMulBackend(GfMulBackend backend);
+
+/** Computes the numEcCodewords (at most 30) error correction codewords of
+ * the first numDataCodewords bytes of codewords, and writes them in place
+ * right after them. Does not allocate.
+ *
+ * Returns false if the arguments are out of range.
+ */
+bool writeErrorCorrectionCodewords(unsigned char *codewords,
+                                   size_t numDataCodewords,
+                                   unsigned int numEcCodewords);
+
+/** Same as writeErrorCorrectionCodewords, but returns the error correction
+ * codewords in a heap allocated buffer that must be freed by the caller.
+ */
+unsigned char *createErrorCorrectionCodewords(
+    const unsigned char *dataCodewords, size_t numDataCodewords,
+    unsigned int numEcCodewords);
+
+/** Encodes the strLength bytes of str, which must be valid UTF-8, into the
+ * codewordsSize data codewords of bitStream, for a symbol of the given
+ * version. Does not allocate.
+ *
+ * Returns false if the string is not valid UTF-8 or does not fit.
+ */
+bool encodeStringInto(const unsigned char *str, size_t strLength,
+                      unsigned int version, unsigned char *bitStream,
+                      size_t codewordsSize);
+
+/** Same as encodeStringInto, but returns the data codewords in a heap
+ * allocated buffer that must be freed by the caller.
+ */
+unsigned char *encodeString(const unsigned char *str, size_t strLength,
+                            unsigned int version, size_t codewordsSize);
+
+/** Resets the symbol to an empty QR Code of the given version and error
+ * correction level.
+ */
+void initQrCode(QrCode *qrcode, unsigned int version,
+                ErrorCorrectionLevel errorCorrectionLevel);
+
+// The following write the function patterns and mark their modules as such.
+// They must all be written before writeEncodedString.
+void writeFinderPatterns(QrCode *qrcode);
+void writeTimingPatterns(QrCode *qrcode);
+void writeAlignmentPatterns(QrCode *qrcode);
+void writeVersionInformation(QrCode *qrcode);
+void writeFormatInformation(QrCode *qrcode);
+void writeDarkModule(QrCode *qrcode);
+
+/** Splits the data codewords of the symbol into its error correction blocks,
+ * computes the error correction codewords of each block and writes the final
+ * interleaved sequence of codewords. Does not allocate.
+ */
+void writeErrorCorrectionBlocks(QrCode *qrcode);
+
+/** Places the codewords in the data modules of the symbol, which must all be
+ * light, following the placement order of its version. The placement order
+ * is computed once per version and cached.
+ */
+void writeEncodedString(QrCode *qrcode, const unsigned char *encodedStr,
+                        size_t encodedStrLength);
+
+/** Inverts the data modules selected by the given mask pattern (0 to 7), by
+ * XORing the rows with a plane of the pattern cached for the version.
+ * Applying the same pattern twice restores the symbol.
+ */
+void applyMaskPattern(QrCode *qrcode, unsigned int maskPattern);
+
+/** Returns the penalty score of the symbol as masked, see 7.8.3.1. Lower is
+ * better.
+ */
+unsigned int getPenaltyScore(const QrCode *qrcode);
+
+/** Runs the whole pipeline, from the input string to the final symbol, using
+ * the smallest version the string fits in at the given error correction
+ * level.
+ *
+ * The string must be valid UTF-8. It does not need to be NUL terminated and
+ * may contain NUL bytes. Returns false if the string could not be encoded.
+ */
+bool encodeQrCode(QrCode *qrcode, const unsigned char *str, size_t strLength,
+                  ErrorCorrectionLevel errorCorrectionLevel);
+
+/** Ways of rendering a symbol. */
+typedef enum {
+  // Text where every module is two full blocks (dark) or two spaces (light)
+  // wide and one line tall.
+  OUTPUT_FORMAT_TEXT,
+  // Text where every character stands for two modules of the same column,
+  // using half blocks: half the lines and about a third of the bytes of
+  // OUTPUT_FORMAT_TEXT.
+  OUTPUT_FORMAT_COMPACT_TEXT,
+  // Binary PBM (P4) image, one bit per pixel.
+  OUTPUT_FORMAT_PBM,
+  // Binary PGM (P5) image, one byte per pixel.
+  OUTPUT_FORMAT_PGM,
+  // 1-bit grayscale PNG image.
+  OUTPUT_FORMAT_PNG,
+  // SVG image drawing the dark modules with a single path, where each
+  // horizontal run of dark modules is one rectangle.
+  OUTPUT_FORMAT_SVG,
+} OutputFormat;
+
+typedef struct {
+  OutputFormat format;
+  // Light modules around the symbol, see 6.3.8. The specification requires
+  // at least 4: smaller sizes, down to 0 for images placed on a light
+  // background of their own, are allowed at the caller's risk.
+  unsigned int quietZoneSize;
+  // Side of a module in pixels for the image formats, from 1 to MAX_SCALE.
+  // Ignored by the text formats. Sets the width and height of SVG images.
+  unsigned int scale;
+  // How OUTPUT_FORMAT_PNG compresses the image.
+  PngCompression pngCompression;
+} RenderOptions;
+
+/** Returns the number of bytes renderInto may write for the symbol, which
+ * includes the scratch space some formats need.
+ */
+size_t getRenderedSize(const QrCode *qrcode, const RenderOptions *options);
+
+/** Renders the symbol into buffer, which must hold at least getRenderedSize
+ * bytes. Returns the number of bytes written. Does not allocate.
+ */
+size_t renderInto(const QrCode *qrcode, const RenderOptions *options,
+                  char *buffer);
+
+/** Returns the width and height in pixels of the images of the symbol: its
+ * side and quiet zone, in modules, times the scale.
+ */
+size_t getImageSide(const QrCode *qrcode, const RenderOptions *options);
+
+/** Rasterizes the symbol and its quiet zone into a 1-bit image of
+ * getImageSide rows, each stride bytes after the previous one. A row is
+ * (getImageSide + 7) / 8 bytes of pixels, the leftmost in the most
+ * significant bit; the bytes between rows are left untouched. Dark pixels
+ * are set, or cleared if invert is true.
+ *
+ * Each row of modules is expanded once, a byte of modules at a time through
+ * a lookup table, then copied scale - 1 times. Does not allocate.
+ */
+void rasterizeQrCode(const QrCode *qrcode, const RenderOptions *options,
+                     bool invert, unsigned char *pixels, size_t stride);
+
+/** Writes the rendered symbol to out, with a single write of a heap
+ * allocated buffer.
+ *
+ * Returns false if the buffer could not be allocated or written.
+ */
+bool render(const QrCode *qrcode, const RenderOptions *options, FILE *out);
+
+#endif  // QRENDER_H_
@@ -12,7 +12,11 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import io
+import os
 import random
+import re
+import select
 import string
 import subprocess
 from PIL import Image
@@ -20,25 +24,68 @@ import pyzbar.pyzbar as pyzbar
 
 MODULE_WHITE = "  "
 MODULE_BLACK = "██"
+# Half blocks of the compact format, mapped to the colors of the top and bottom
+# modules (True is dark).
+HALF_BLOCKS = {
+    " ": (False, False),
+    "▀": (True, False),
+    "▄": (False, True),
+    "█": (True, True),
+}
+
+# Formats rendered as binary images, which PIL reads directly.
+IMAGE_FORMATS = ("pbm", "pgm", "png")
+# Side of a module in pixels in images.
+IMAGE_SCALE = 10
 
 N_ITERATIONS = 100
 
-# Most ranges are commented out due to an issue in pyzbar itself:
+ERROR_CORRECTION_LEVELS = "LMQH"
+# UTF-8 bytes that fit in a Version 40 symbol at the highest error correction
+# level, after the ECI header declaring them as such.
+MAX_BYTES = 1272
+# Same, for digits in numeric mode.
+MAX_DIGITS = 3057
+# Same, for characters in alphanumeric mode.
+MAX_ALPHANUMERIC_CHARACTERS = 1852
+ALPHANUMERIC_CHARACTERS = string.digits + string.ascii_uppercase + " $%*+-./:"
+# Same, for characters in Kanji mode.
+MAX_KANJI_CHARACTERS = 784
+# Hiragana, katakana and a few kanji, all of which have a Shift JIS code in
+# Kanji mode.
+KANJI_CHARACTERS = "".join([
+    "".join(chr(cp) for cp in range(0x3041, 0x3093 + 1)),
+    "".join(chr(cp) for cp in range(0x30A1, 0x30F6 + 1)),
+    "日本語漢字価格円送料無料注文番号東京大阪",
+])
+
+# Byte mode segments holding characters outside ASCII are preceded by an ECI
+# header declaring them UTF-8, without which decoders guess their encoding:
 # https://github.com/NaturalHistoryMuseum/pyzbar/pull/82.
 ALL_PRINTABLE_CHARACTERS = "".join([
     string.printable,  # ASCII printable characters
-    # ''.join(chr(cp) for cp in range(0x00A1, 0x00FF + 1)),   # Latin-1 Supplement
-    # ''.join(chr(cp) for cp in range(0x0100, 0x017F + 1)),   # Latin Extended-A
-    # ''.join(chr(cp) for cp in range(0x0370, 0x03FF + 1)),   # Greek and Coptic
-    # ''.join(chr(cp) for cp in range(0x0400, 0x04FF + 1)),   # Cyrillic
-    # ''.join(chr(cp) for cp in range(0x2200, 0x22FF + 1)),   # Mathematical Operators
+    "".join(chr(cp) for cp in range(0x00A1, 0x00FF + 1)),  # Latin-1 Supplement
+    "".join(chr(cp) for cp in range(0x0100, 0x017F + 1)),  # Latin Extended-A
+    "".join(chr(cp) for cp in range(0x0370, 0x03FF + 1)),  # Greek and Coptic
+    "".join(chr(cp) for cp in range(0x0400, 0x04FF + 1)),  # Cyrillic
+    "".join(chr(cp) for cp in range(0x2200, 0x22FF + 1)),  # Mathematical Operators
     "".join(chr(cp) for cp in range(0x1F600, 0x1F64F + 1)),  # Emojis
-    # ''.join(chr(cp) for cp in range(0x3000, 0x303F + 1)),   # CJK Symbols and Punctuation
-    # ''.join(chr(cp) for cp in range(0x4E00, 0x4FFF + 1))    # Common CJK Unified Ideographs (subset)
+    "".join(chr(cp) for cp in range(0x3000, 0x303F + 1)),  # CJK Symbols and Punctuation
+    "".join(chr(cp) for cp in range(0x4E00, 0x4FFF + 1)),  # Common CJK Unified Ideographs (subset)
 ])
 
+# Malformed UTF-8: a byte that never appears, a truncated sequence, an
+# overlong encoding of "/", a surrogate and a code point past U+10FFFF.
+INVALID_UTF8_STRINGS = (
+    b"\xff",
+    b"caf\xc3",
+    b"\xc0\xaf",
+    b"\xed\xa0\x80",
+    b"\xf4\x90\x80\x80",
+)
 
-def generate_random_string(max_bytes=17):
+
+def generate_random_string(max_bytes=MAX_BYTES):
   result = ""
   current_bytes = 0
 
@@ -63,17 +110,131 @@ def generate_random_string(max_bytes=17):
   return result
 
 
+def generate_random_digits(max_digits=MAX_DIGITS):
+  length = random.randint(1, max_digits)
+  return "".join(random.choice(string.digits) for _ in range(length))
+
+
+def generate_random_alphanumeric(max_length=MAX_ALPHANUMERIC_CHARACTERS):
+  length = random.randint(1, max_length)
+  return "".join(
+      random.choice(ALPHANUMERIC_CHARACTERS) for _ in range(length)
+  )
+
+
+def generate_random_kanji(max_length=MAX_KANJI_CHARACTERS):
+  length = random.randint(1, max_length)
+  return "".join(random.choice(KANJI_CHARACTERS) for _ in range(length))
+
+
+def generate_random_mixed(max_runs=50):
+  # Runs of digits, alphanumeric characters, kanji and other printable
+  # characters, which end up in segments of different modes.
+  runs = []
+  for _ in range(random.randint(1, max_runs)):
+    characters = random.choice((
+        string.digits,
+        ALPHANUMERIC_CHARACTERS,
+        KANJI_CHARACTERS,
+        string.printable,
+    ))
+    runs.append(
+        "".join(
+            random.choice(characters) for _ in range(random.randint(1, 20))
+        )
+    )
+  return "".join(runs)
+
+
 def compile():
-  subprocess.run(["gcc", "qrender.c", "-o", "qrender"], check=True)
+  subprocess.run(
+      [
+          "gcc",
+          "-pthread",
+          "qrender.c",
+          "png.c",
+          "batch.c",
+          "threadpool.c",
+          "main.c",
+          "-o",
+          "qrender",
+      ],
+      check=True,
+  )
 
 
-def run_qrender(input_string):
+def run_qrender(input_string, error_correction_level="L", output_format="text"):
+  is_image = output_format in IMAGE_FORMATS
   result = subprocess.run(
-      ["./qrender", input_string], capture_output=True, text=True, check=True
+      [
+          "./qrender",
+          "-e",
+          error_correction_level,
+          "-f",
+          output_format,
+          "-s",
+          str(IMAGE_SCALE),
+          "--",
+          input_string,
+      ],
+      capture_output=True,
+      text=not is_image,
+      check=True,
   )
   return result.stdout
 
 
+def run_qrender_batch(input_strings, error_correction_level="L"):
+  result = subprocess.run(
+      ["./qrender", "-e", error_correction_level, "-0"],
+      input="\0".join(input_strings) + "\0",
+      capture_output=True,
+      text=True,
+      check=True,
+  )
+  return result.stdout.split("\0")[:-1]
+
+
+def run_qrender_streaming(input_strings, timeout=10):
+  # Every record is read back before the next one is written, with the input
+  # left open: batch mode must write each symbol as soon as it is encoded.
+  process = subprocess.Popen(
+      ["./qrender", "-0", "-j", "4"],
+      stdin=subprocess.PIPE,
+      stdout=subprocess.PIPE,
+  )
+  outputs = []
+  for input_string in input_strings:
+    process.stdin.write(input_string.encode("utf-8") + b"\0")
+    process.stdin.flush()
+    output = b""
+    while not output.endswith(b"\0"):
+      ready, _, _ = select.select([process.stdout], [], [], timeout)
+      if not ready:
+        break
+      chunk = os.read(process.stdout.fileno(), 65536)
+      if not chunk:
+        break
+      output += chunk
+    outputs.append(
+        output[:-1].decode("utf-8") if output.endswith(b"\0") else None
+    )
+  process.stdin.close()
+  process.stdout.close()
+  process.wait()
+  return outputs
+
+
+def test_invalid_utf8(input_bytes):
+  result = subprocess.run(
+      ["./qrender", "--", input_bytes], capture_output=True
+  )
+  if result.returncode != 0 and b"not valid UTF-8" in result.stderr:
+    print(f"✅ Rejected: {input_bytes!r}")
+  else:
+    print(f"⛔ Not rejected: {input_bytes!r}")
+
+
 def get_qr_image_from_text(qr_text):
   lines = qr_text.split("\n")
 
@@ -81,9 +242,8 @@ def get_qr_image_from_text(qr_text):
   width = max(len(line) for line in lines) // 2
   height = len(lines)
 
-  # Create a new blank image with white background.
-  scale = 10  # Scale factor for better resolution.
-  img = Image.new("1", (width * scale, height * scale), 1)
+  # Create a new blank image with white background, one pixel per module.
+  img = Image.new("1", (width, height), 1)
   pixels = img.load()
 
   # Fill in black pixels where there are black modules.
@@ -92,16 +252,61 @@ def get_qr_image_from_text(qr_text):
       if x + 1 < len(line):
         chars = line[x : x + 2]
         if chars == MODULE_BLACK:
-          # Fill a scaled block of pixels.
-          for sy in range(scale):
-            for sx in range(scale):
-              pixels[(x // 2) * scale + sx, y * scale + sy] = 0  # Black pixel.
-  return img
+          pixels[x // 2, y] = 0  # Black pixel.
+
+  # Scale up for better resolution.
+  scale = 10
+  return img.resize((width * scale, height * scale), Image.NEAREST)
+
+
+def get_qr_image_from_compact_text(qr_text):
+  # Expand every line back into the two rows of modules it stands for.
+  rows = []
+  for line in qr_text.split("\n"):
+    for half in range(2):
+      rows.append(
+          "".join(
+              MODULE_BLACK if HALF_BLOCKS[c][half] else MODULE_WHITE
+              for c in line
+          )
+      )
+  return get_qr_image_from_text("\n".join(rows))
+
+
+def get_qr_image_from_svg(qr_svg):
+  side = int(re.search(r'viewBox="0 0 (\d+) \d+"', qr_svg).group(1))
+  path = re.search(r'<path d="([^"]*)"', qr_svg).group(1)
+
+  img = Image.new("1", (side, side), 1)
+  pixels = img.load()
+
+  # Every run of dark modules is a rectangle one module tall, moved relative
+  # to the previous one.
+  x = y = 0
+  for dx, dy, length in re.findall(r"m(-?\d+) (-?\d+)h(\d+)v1h-\d+z", path):
+    x += int(dx)
+    y += int(dy)
+    for sx in range(x, x + int(length)):
+      pixels[sx, y] = 0  # Black pixel.
 
+  # Scale up for better resolution.
+  scale = 10
+  return img.resize((side * scale, side * scale), Image.NEAREST)
 
-def test_qrender(input_text):
-  qr_text = run_qrender(input_text)
-  qr_image = get_qr_image_from_text(qr_text)
+
+def test_qrender(
+    input_text, qr_text=None, error_correction_level="L", output_format="text"
+):
+  if qr_text is None:
+    qr_text = run_qrender(input_text, error_correction_level, output_format)
+  if output_format in IMAGE_FORMATS:
+    qr_image = Image.open(io.BytesIO(qr_text))
+  elif output_format == "svg":
+    qr_image = get_qr_image_from_svg(qr_text)
+  elif output_format == "compact":
+    qr_image = get_qr_image_from_compact_text(qr_text)
+  else:
+    qr_image = get_qr_image_from_text(qr_text)
 
   decoded_objects = pyzbar.decode(qr_image)
   decoded_text = decoded_objects[0].data.decode("utf-8")
@@ -115,4 +320,58 @@ def test_qrender(input_text):
 if __name__ == "__main__":
   compile()
   for _ in range(N_ITERATIONS):
-    test_qrender(generate_random_string())
+    test_qrender(
+        generate_random_string(),
+        error_correction_level=random.choice(ERROR_CORRECTION_LEVELS),
+    )
+
+  for _ in range(N_ITERATIONS // 4):
+    test_qrender(
+        generate_random_digits(),
+        error_correction_level=random.choice(ERROR_CORRECTION_LEVELS),
+    )
+
+  for _ in range(N_ITERATIONS // 4):
+    test_qrender(
+        generate_random_alphanumeric(),
+        error_correction_level=random.choice(ERROR_CORRECTION_LEVELS),
+    )
+
+  for _ in range(N_ITERATIONS // 4):
+    test_qrender(
+        generate_random_kanji(),
+        error_correction_level=random.choice(ERROR_CORRECTION_LEVELS),
+    )
+
+  test_qrender("INV-2025-000123456")
+  for _ in range(N_ITERATIONS // 4):
+    test_qrender(
+        generate_random_mixed(),
+        error_correction_level=random.choice(ERROR_CORRECTION_LEVELS),
+    )
+
+  for input_bytes in INVALID_UTF8_STRINGS:
+    test_invalid_utf8(input_bytes)
+
+  for _ in range(N_ITERATIONS // 4):
+    test_qrender(generate_random_string(), output_format="compact")
+
+  for output_format in IMAGE_FORMATS + ("svg",):
+    for _ in range(N_ITERATIONS // 4):
+      test_qrender(generate_random_string(), output_format=output_format)
+
+  for level in ERROR_CORRECTION_LEVELS:
+    batch_inputs = [
+        generate_random_string() for _ in range(N_ITERATIONS // 4)
+    ]
+    batch_outputs = run_qrender_batch(batch_inputs, level)
+    for input_text, qr_text in zip(batch_inputs, batch_outputs):
+      test_qrender(input_text, qr_text)
+
+  streaming_inputs = [generate_random_string() for _ in range(3)]
+  streaming_outputs = run_qrender_streaming(streaming_inputs)
+  for input_text, qr_text in zip(streaming_inputs, streaming_outputs):
+    if qr_text is None:
+      print(f'⛔ Not written before the end of the input: "{input_text}"')
+    else:
+      test_qrender(input_text, qr_text)
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "threadpool.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define INITIAL_QUEUE_CAPACITY 64
+
+typedef struct {
+  ThreadPoolTask task;
+  void *arg;
+} QueuedTask;
+
+// A double-ended queue of tasks, stored in a growable ring buffer. The owner
+// takes tasks from the front, thieves from the back, so the two rarely compete
+// for the same end of the queue.
+typedef struct {
+  pthread_mutex_t lock;
+  QueuedTask *tasks;
+  size_t capacity;  // Always a power of 2.
+  size_t front;
+  size_t size;
+} TaskQueue;
+
+typedef struct {
+  ThreadPool *pool;
+  unsigned int index;
+  pthread_t thread;
+  TaskQueue queue;
+} Worker;
+
+struct ThreadPool {
+  Worker *workers;
+  unsigned int numWorkers;
+  unsigned int numStartedWorkers;
+  unsigned int nextQueue;
+
+  // Number of tasks sitting in a queue. Incremented while holding lock,
+  // before the task is pushed, so that it never drops below the number of
+  // queued tasks and idle workers waiting on workAvailable never miss a
+  // wakeup.
+  atomic_size_t pendingTasks;
+  pthread_mutex_t lock;
+  pthread_cond_t workAvailable;
+  bool shuttingDown;
+};
+
+static bool pushTask(TaskQueue *queue, QueuedTask task) {
+  pthread_mutex_lock(&queue->lock);
+  if (queue->size == queue->capacity) {
+    size_t newCapacity = queue->capacity * 2;
+    QueuedTask *tasks =
+        (QueuedTask *)malloc(newCapacity * sizeof(QueuedTask));
+    if (tasks == NULL) {
+      pthread_mutex_unlock(&queue->lock);
+      return false;
+    }
+    for (size_t i = 0; i < queue->size; i++) {
+      tasks[i] = queue->tasks[(queue->front + i) & (queue->capacity - 1)];
+    }
+    free(queue->tasks);
+    queue->tasks = tasks;
+    queue->capacity = newCapacity;
+    queue->front = 0;
+  }
+  queue->tasks[(queue->front + queue->size) & (queue->capacity - 1)] = task;
+  queue->size++;
+  pthread_mutex_unlock(&queue->lock);
+  return true;
+}
+
+static bool popFrontTask(TaskQueue *queue, QueuedTask *task) {
+  pthread_mutex_lock(&queue->lock);
+  bool found = queue->size > 0;
+  if (found) {
+    *task = queue->tasks[queue->front];
+    queue->front = (queue->front + 1) & (queue->capacity - 1);
+    queue->size--;
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return found;
+}
+
+static bool popBackTask(TaskQueue *queue, QueuedTask *task) {
+  pthread_mutex_lock(&queue->lock);
+  bool found = queue->size > 0;
+  if (found) {
+    queue->size--;
+    *task =
+        queue->tasks[(queue->front + queue->size) & (queue->capacity - 1)];
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return found;
+}
+
+static bool takeTask(Worker *worker, QueuedTask *task) {
+  if (popFrontTask(&worker->queue, task)) {
+    return true;
+  }
+
+  // Our own queue is empty: steal from the others, starting from our
+  // neighbour so that thieves spread over different victims.
+  ThreadPool *pool = worker->pool;
+  for (unsigned int i = 1; i < pool->numWorkers; i++) {
+    Worker *victim = &pool->workers[(worker->index + i) % pool->numWorkers];
+    if (popBackTask(&victim->queue, task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void *runWorker(void *arg) {
+  Worker *worker = (Worker *)arg;
+  ThreadPool *pool = worker->pool;
+
+  for (;;) {
+    QueuedTask task;
+    if (takeTask(worker, &task)) {
+      atomic_fetch_sub(&pool->pendingTasks, 1);
+      task.task(task.arg, worker->index);
+      continue;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (atomic_load(&pool->pendingTasks) == 0 && !pool->shuttingDown) {
+      pthread_cond_wait(&pool->workAvailable, &pool->lock);
+    }
+    bool done = atomic_load(&pool->pendingTasks) == 0 && pool->shuttingDown;
+    pthread_mutex_unlock(&pool->lock);
+    if (done) {
+      return NULL;
+    }
+  }
+}
+
+ThreadPool *createThreadPool(unsigned int numWorkers) {
+  if (numWorkers == 0) {
+    return NULL;
+  }
+
+  ThreadPool *pool = (ThreadPool *)calloc(1, sizeof(ThreadPool));
+  if (pool == NULL) {
+    return NULL;
+  }
+  pool->workers = (Worker *)calloc(numWorkers, sizeof(Worker));
+  if (pool->workers == NULL) {
+    free(pool);
+    return NULL;
+  }
+  pool->numWorkers = numWorkers;
+  atomic_init(&pool->pendingTasks, 0);
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->workAvailable, NULL);
+
+  for (unsigned int i = 0; i < numWorkers; i++) {
+    Worker *worker = &pool->workers[i];
+    worker->pool = pool;
+    worker->index = i;
+    pthread_mutex_init(&worker->queue.lock, NULL);
+    worker->queue.capacity = INITIAL_QUEUE_CAPACITY;
+  }
+
+  for (unsigned int i = 0; i < numWorkers; i++) {
+    TaskQueue *queue = &pool->workers[i].queue;
+    queue->tasks = (QueuedTask *)malloc(queue->capacity * sizeof(QueuedTask));
+    if (queue->tasks == NULL) {
+      destroyThreadPool(pool);
+      return NULL;
+    }
+  }
+
+  for (unsigned int i = 0; i < numWorkers; i++) {
+    if (pthread_create(&pool->workers[i].thread, NULL, runWorker,
+                       &pool->workers[i]) != 0) {
+      destroyThreadPool(pool);
+      return NULL;
+    }
+    pool->numStartedWorkers++;
+  }
+
+  return pool;
+}
+
+bool submitThreadPoolTask(ThreadPool *pool, ThreadPoolTask task, void *arg) {
+  Worker *worker = &pool->workers[pool->nextQueue];
+  pool->nextQueue = (pool->nextQueue + 1) % pool->numWorkers;
+
+  // The task is counted before it can be taken, or a worker taking it
+  // right away would decrement the count below zero. Idle workers only see
+  // the count under lock, once the task is queued.
+  pthread_mutex_lock(&pool->lock);
+  atomic_fetch_add(&pool->pendingTasks, 1);
+  bool pushed = pushTask(&worker->queue, (QueuedTask){task, arg});
+  if (pushed) {
+    pthread_cond_signal(&pool->workAvailable);
+  } else {
+    atomic_fetch_sub(&pool->pendingTasks, 1);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return pushed;
+}
+
+void destroyThreadPool(ThreadPool *pool) {
+  pthread_mutex_lock(&pool->lock);
+  pool->shuttingDown = true;
+  pthread_cond_broadcast(&pool->workAvailable);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (unsigned int i = 0; i < pool->numStartedWorkers; i++) {
+    pthread_join(pool->workers[i].thread, NULL);
+  }
+
+  for (unsigned int i = 0; i < pool->numWorkers; i++) {
+    pthread_mutex_destroy(&pool->workers[i].queue.lock);
+    free(pool->workers[i].queue.tasks);
+  }
+  pthread_cond_destroy(&pool->workAvailable);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->workers);
+  free(pool);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <stdbool.h>
+
+/** A task run by the pool. workerIndex identifies the thread running it (in
+ * [0, numWorkers)), so tasks can use per-worker state without locking.
+ */
+typedef void (*ThreadPoolTask)(void *arg, unsigned int workerIndex);
+
+typedef struct ThreadPool ThreadPool;
+
+/** Starts a pool of numWorkers threads. Every worker owns a task queue; idle
+ * workers steal tasks from the queues of the others.
+ *
+ * Returns NULL if the pool could not be created.
+ */
+ThreadPool *createThreadPool(unsigned int numWorkers);
+
+/** Queues a task. Tasks are spread round-robin across the worker queues. */
+bool submitThreadPoolTask(ThreadPool *pool, ThreadPoolTask task, void *arg);
+
+/** Runs all the queued tasks, then stops the workers and frees the pool. */
+void destroyThreadPool(ThreadPool *pool);
+
+#endif  // THREADPOOL_H_
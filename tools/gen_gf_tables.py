@@ -0,0 +1,184 @@
+# Copyright 2025 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates gf_tables.h, the GF(256) lookup tables used by qrender.c.
+
+Usage: python3 tools/gen_gf_tables.py > gf_tables.h
+"""
+
+GF_SIZE = 256
+GF_PRIMITIVE_POLY = 0b100011101  # x^8 + x^4 + x^3 + x^2 + 1
+# Largest number of error correction codewords per block, see Table 9.
+MAX_GENERATOR_DEGREE = 30
+
+LICENSE = """/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+
+def build_tables():
+  exp_table = [0] * (2 * GF_SIZE)
+  log_table = [0] * GF_SIZE
+
+  # In GF(256) arithmetic, multiplying elements means performing polynomial
+  # multiplication modulo the primitive polynomial: shifting x left by one
+  # multiplies the polynomial it represents by x, and the primitive polynomial
+  # is subtracted (XORed) whenever the degree reaches 8.
+  x = 1
+  for i in range(GF_SIZE - 1):
+    exp_table[i] = x
+    log_table[x] = i
+    x <<= 1
+    if x >= GF_SIZE:
+      x ^= GF_PRIMITIVE_POLY
+
+  # α^255 = α^0 = 1, so the exponential table repeats with period 255. Storing
+  # it twice lets gfMul index it with log(a) + log(b) <= 508 directly, without
+  # reducing the sum modulo 255.
+  for i in range(GF_SIZE - 1, 2 * GF_SIZE):
+    exp_table[i] = exp_table[i - (GF_SIZE - 1)]
+
+  # log(0) is undefined, callers must handle 0 on their own.
+  log_table[0] = 0
+  return exp_table, log_table
+
+
+def build_nibble_product_table(exp_table, log_table):
+  """Products of every factor with every low and every high nibble.
+
+  Row f holds f * n for n in 0..15 followed by f * (n << 4) for n in 0..15, so
+  that f * x = row[x & 0xf] ^ row[16 + (x >> 4)]. Each half is laid out to be
+  used directly as a pshufb lookup table.
+  """
+
+  def mul(a, b):
+    if a == 0 or b == 0:
+      return 0
+    return exp_table[log_table[a] + log_table[b]]
+
+  return [
+      [mul(f, n) for n in range(16)] + [mul(f, n << 4) for n in range(16)]
+      for f in range(GF_SIZE)
+  ]
+
+
+def build_generator_polynomials(exp_table, log_table):
+  """Generator polynomials (x - α^0)(x - α^1)...(x - α^(n-1)), see Annex A.
+
+  Row n holds the coefficients of the degree n polynomial, from x^n (always 1)
+  down to x^0, padded with zeros.
+  """
+
+  def mul(a, b):
+    if a == 0 or b == 0:
+      return 0
+    return exp_table[log_table[a] + log_table[b]]
+
+  rows = []
+  generator = [1]
+  for degree in range(MAX_GENERATOR_DEGREE + 1):
+    rows.append(generator + [0] * (MAX_GENERATOR_DEGREE + 1 - len(generator)))
+    # Multiply by (x - α^degree), where subtraction is XOR.
+    next_generator = generator + [0]
+    for j, coefficient in enumerate(generator):
+      next_generator[j + 1] ^= mul(coefficient, exp_table[degree])
+    generator = next_generator
+  return rows
+
+
+def format_array(declaration, values):
+  lines = [declaration + " = {"]
+  for i in range(0, len(values), 12):
+    lines.append(
+        "    " + ", ".join("0x%02x" % v for v in values[i : i + 12]) + ","
+    )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def format_2d_array(declaration, rows):
+  lines = [declaration + " = {"]
+  for row in rows:
+    for i in range(0, len(row), 8):
+      lines.append(
+          ("    {" if i == 0 else "     ")
+          + ", ".join("0x%02x" % v for v in row[i : i + 8])
+          + ("}," if i + 8 >= len(row) else ",")
+      )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def main():
+  exp_table, log_table = build_tables()
+  print(LICENSE)
+  print()
+  print("// Generated by tools/gen_gf_tables.py. Do not edit.")
+  print()
+  print("#ifndef GF_TABLES_H_")
+  print("#define GF_TABLES_H_")
+  print()
+  print("// gfExpLookupTable[i] = α^i, for 0 <= i < 512.")
+  print(
+      format_array(
+          "static const unsigned char gfExpLookupTable[%d]" % len(exp_table),
+          exp_table,
+      )
+  )
+  print()
+  print("// gfLogLookupTable[α^i] = i. The entry for 0 is unused.")
+  print(
+      format_array(
+          "static const unsigned char gfLogLookupTable[%d]" % len(log_table),
+          log_table,
+      )
+  )
+  print()
+  print("// gfNibbleProductTable[f] = {f * n, f * (n << 4)} for 0 <= n < 16.")
+  print(
+      format_2d_array(
+          "static const unsigned char gfNibbleProductTable[%d][32]" % GF_SIZE,
+          build_nibble_product_table(exp_table, log_table),
+      )
+  )
+  print()
+  print("#define MAX_GENERATOR_POLYNOMIAL_DEGREE %d" % MAX_GENERATOR_DEGREE)
+  print()
+  print("// gfGeneratorPolynomials[n][j] is the coefficient of x^(n - j) in the")
+  print("// generator polynomial of degree n, for n <= %d." % MAX_GENERATOR_DEGREE)
+  print(
+      format_2d_array(
+          "static const unsigned char gfGeneratorPolynomials[%d][%d]"
+          % (MAX_GENERATOR_DEGREE + 1, MAX_GENERATOR_DEGREE + 1),
+          build_generator_polynomials(exp_table, log_table),
+      )
+  )
+  print()
+  print("#endif  // GF_TABLES_H_")
+
+
+if __name__ == "__main__":
+  main()
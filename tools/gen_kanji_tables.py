@@ -0,0 +1,173 @@
+# Copyright 2025 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates kanji_tables.h, the Unicode to Kanji mode table used by qrender.c.
+
+Usage: python3 tools/gen_kanji_tables.py > kanji_tables.h
+"""
+
+# Code points are looked up in blocks of 2^KANJI_BLOCK_BITS.
+KANJI_BLOCK_BITS = 6
+KANJI_BLOCK_SIZE = 1 << KANJI_BLOCK_BITS
+# Only the Basic Multilingual Plane has characters of Shift JIS.
+NUM_CODE_POINTS = 0x10000
+
+LICENSE = """/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+
+def get_kanji_value(code_point):
+  """13-bit value of a character in Kanji mode, see 7.4.6, or None.
+
+  Only the double-byte Shift JIS characters from 0x8140 to 0x9FFC and from
+  0xE040 to 0xEBBF can be encoded in Kanji mode. Characters that do not come
+  back unchanged from Shift JIS are left to byte mode.
+  """
+  if 0xD800 <= code_point < 0xE000:
+    return None
+  character = chr(code_point)
+  try:
+    encoded = character.encode("shift_jis")
+  except UnicodeEncodeError:
+    return None
+  if len(encoded) != 2 or encoded.decode("shift_jis") != character:
+    return None
+  shift_jis = encoded[0] << 8 | encoded[1]
+  if 0x8140 <= shift_jis <= 0x9FFC:
+    shift_jis -= 0x8140
+  elif 0xE040 <= shift_jis <= 0xEBBF:
+    shift_jis -= 0xC140
+  else:
+    return None
+  return (shift_jis >> 8) * 0xC0 + (shift_jis & 0xFF)
+
+
+def build_tables():
+  """Rank tables of the code points that have a value in Kanji mode.
+
+  Returns the index of every block of code points (1 + its position in the
+  list of blocks, 0 for blocks without any such code point), the list of
+  blocks as (mask of the code points that have a value, index of the value of
+  the first one), and the values in the order of their code points.
+  """
+  block_index = []
+  blocks = []
+  values = []
+  for start in range(0, NUM_CODE_POINTS, KANJI_BLOCK_SIZE):
+    mask = 0
+    first_value = len(values)
+    for offset in range(KANJI_BLOCK_SIZE):
+      value = get_kanji_value(start + offset)
+      if value is not None:
+        mask |= 1 << offset
+        values.append(value)
+    if mask == 0:
+      block_index.append(0)
+    else:
+      blocks.append((mask, first_value))
+      block_index.append(len(blocks))
+  return block_index, blocks, values
+
+
+def format_array(declaration, values, width, per_line):
+  lines = [declaration + " = {"]
+  for i in range(0, len(values), per_line):
+    lines.append(
+        "    "
+        + ", ".join("0x%0*x" % (width, v) for v in values[i : i + per_line])
+        + ","
+    )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def format_blocks(declaration, blocks):
+  lines = [declaration + " = {"]
+  for i in range(0, len(blocks), 2):
+    lines.append(
+        "    "
+        + ", ".join(
+            "{0x%016x, %d}" % block for block in blocks[i : i + 2]
+        )
+        + ","
+    )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def main():
+  block_index, blocks, values = build_tables()
+  print(LICENSE)
+  print()
+  print("// Generated by tools/gen_kanji_tables.py. Do not edit.")
+  print()
+  print("#ifndef KANJI_TABLES_H_")
+  print("#define KANJI_TABLES_H_")
+  print()
+  print("#include <stdint.h>")
+  print()
+  print("#define KANJI_BLOCK_BITS %d" % KANJI_BLOCK_BITS)
+  print()
+  print("// A block of 2^KANJI_BLOCK_BITS code points: bit j of mask is set if")
+  print("// its code point j has a value in Kanji mode, and the values of the")
+  print("// code points of the block start at kanjiValues[firstValue].")
+  print("typedef struct {")
+  print("  uint64_t mask;")
+  print("  uint16_t firstValue;")
+  print("} KanjiBlock;")
+  print()
+  print("// kanjiBlockIndex[c >> KANJI_BLOCK_BITS] is 1 + the index in")
+  print("// kanjiBlocks of the block of the code point c, or 0 if none of its")
+  print("// code points has a value in Kanji mode.")
+  print(
+      format_array(
+          "static const uint16_t kanjiBlockIndex[%d]" % len(block_index),
+          block_index,
+          3,
+          10,
+      )
+  )
+  print()
+  print(
+      format_blocks(
+          "static const KanjiBlock kanjiBlocks[%d]" % len(blocks), blocks
+      )
+  )
+  print()
+  print("// 13-bit values in Kanji mode, see 7.4.6, in the order of the code")
+  print("// points they belong to.")
+  print(
+      format_array(
+          "static const uint16_t kanjiValues[%d]" % len(values), values, 4, 8
+      )
+  )
+  print()
+  print("#endif  // KANJI_TABLES_H_")
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,217 @@
+# Copyright 2025 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates png_tables.h, the CRC-32 and Deflate tables used by png.c.
+
+Usage: python3 tools/gen_png_tables.py > png_tables.h
+"""
+
+# Reversed CRC-32 polynomial used by PNG, see ISO 3309.
+CRC_POLY = 0xEDB88320
+# Number of CRC tables, one per byte of the 8-byte words processed at once.
+CRC_SLICES = 8
+
+# Base match length and number of extra bits of the length symbols 257 to
+# 285, see RFC 1951, 3.2.5.
+LENGTH_BASES = [
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
+    67, 83, 99, 115, 131, 163, 195, 227, 258,
+]
+LENGTH_EXTRA_BITS = [
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5,
+    5, 5, 5, 0,
+]
+# Base distance and number of extra bits of the distance symbols 0 to 29.
+DISTANCE_BASES = [
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513,
+    769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+]
+DISTANCE_EXTRA_BITS = [
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+    11, 11, 12, 12, 13, 13,
+]
+MAX_MATCH_LENGTH = 258
+
+LICENSE = """/*
+ * Copyright 2025 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+
+def build_crc_tables():
+  """Slice-by-8 tables: table[k][b] is the CRC of byte b followed by k zeros."""
+  tables = [[0] * 256 for _ in range(CRC_SLICES)]
+  for b in range(256):
+    crc = b
+    for _ in range(8):
+      crc = (crc >> 1) ^ (CRC_POLY if crc & 1 else 0)
+    tables[0][b] = crc
+  for k in range(1, CRC_SLICES):
+    for b in range(256):
+      previous = tables[k - 1][b]
+      tables[k][b] = (previous >> 8) ^ tables[0][previous & 0xFF]
+  return tables
+
+
+def reverse_bits(value, length):
+  return int(format(value, "0%db" % length)[::-1], 2)
+
+
+def get_fixed_code(symbol):
+  """Code and length of a literal/length symbol in the fixed Huffman code."""
+  if symbol < 144:
+    return 0b00110000 + symbol, 8
+  if symbol < 256:
+    return 0b110010000 + symbol - 144, 9
+  if symbol < 280:
+    return symbol - 256, 7
+  return 0b11000000 + symbol - 280, 8
+
+
+def build_literal_codes():
+  """Fixed Huffman codes of the literals, bit reversed as they are written."""
+  codes = []
+  for literal in range(256):
+    code, length = get_fixed_code(literal)
+    codes.append((reverse_bits(code, length), length))
+  return codes
+
+
+def build_length_codes():
+  """Codes of every match length: the fixed Huffman code of the length symbol
+  followed by its extra bits, as written to the stream. Lengths 0 to 2 are
+  not valid matches.
+  """
+  codes = [(0, 0)] * 3
+  for length in range(3, MAX_MATCH_LENGTH + 1):
+    # Length 258 has its own symbol, even though 227 + 31 would also reach it.
+    index = max(i for i, base in enumerate(LENGTH_BASES) if base <= length)
+    code, code_length = get_fixed_code(257 + index)
+    extra = length - LENGTH_BASES[index]
+    codes.append((
+        reverse_bits(code, code_length) | extra << code_length,
+        code_length + LENGTH_EXTRA_BITS[index],
+    ))
+  return codes
+
+
+def format_array(declaration, values, width, per_line):
+  lines = [declaration + " = {"]
+  for i in range(0, len(values), per_line):
+    lines.append(
+        "    "
+        + ", ".join("0x%0*x" % (width, v) for v in values[i : i + per_line])
+        + ","
+    )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def format_pairs(declaration, pairs):
+  lines = [declaration + " = {"]
+  for i in range(0, len(pairs), 5):
+    lines.append(
+        "    "
+        + ", ".join("{0x%04x, %d}" % pair for pair in pairs[i : i + 5])
+        + ","
+    )
+  lines.append("};")
+  return "\n".join(lines)
+
+
+def main():
+  print(LICENSE)
+  print()
+  print("// Generated by tools/gen_png_tables.py. Do not edit.")
+  print()
+  print("#ifndef PNG_TABLES_H_")
+  print("#define PNG_TABLES_H_")
+  print()
+  print("#include <stdint.h>")
+  print()
+  print("// pngCrcTables[k][b] is the CRC-32 of the byte b followed by k zero")
+  print("// bytes, so that 8 bytes can be folded in at once.")
+  lines = ["static const uint32_t pngCrcTables[%d][256] = {" % CRC_SLICES]
+  for table in build_crc_tables():
+    body = format_array("", table, 8, 6).split("\n")[1:-1]
+    lines.append("    {")
+    lines.extend("    " + line for line in body)
+    lines.append("    },")
+  lines.append("};")
+  print("\n".join(lines))
+  print()
+  print("// A Deflate code: bits in the order they are written, least")
+  print("// significant first, and their number.")
+  print("typedef struct {")
+  print("  uint16_t bits;")
+  print("  uint8_t length;")
+  print("} DeflateCode;")
+  print()
+  print("// Fixed Huffman codes of the literal bytes, see RFC 1951, 3.2.6.")
+  print(
+      format_pairs(
+          "static const DeflateCode deflateLiteralCodes[256]",
+          build_literal_codes(),
+      )
+  )
+  print()
+  print("#define DEFLATE_MAX_MATCH_LENGTH %d" % MAX_MATCH_LENGTH)
+  print()
+  print("// deflateLengthCodes[n] is the fixed Huffman code of a match of n")
+  print("// bytes, followed by its extra bits, for 3 <= n <= 258.")
+  print(
+      format_pairs(
+          "static const DeflateCode deflateLengthCodes[%d]"
+          % (MAX_MATCH_LENGTH + 1),
+          build_length_codes(),
+      )
+  )
+  print()
+  print("// Base distance and number of extra bits of each distance symbol.")
+  print("// The fixed code of a distance symbol is the symbol on 5 bits.")
+  print(
+      format_array(
+          "static const uint16_t deflateDistanceBases[%d]"
+          % len(DISTANCE_BASES),
+          DISTANCE_BASES,
+          4,
+          8,
+      )
+  )
+  print(
+      format_array(
+          "static const uint8_t deflateDistanceExtraBits[%d]"
+          % len(DISTANCE_EXTRA_BITS),
+          DISTANCE_EXTRA_BITS,
+          2,
+          12,
+      )
+  )
+  print()
+  print("#endif  // PNG_TABLES_H_")
+
+
+if __name__ == "__main__":
+  main()